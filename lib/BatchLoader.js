@@ -0,0 +1,140 @@
+const MAX_BATCH_DEFAULT = 500;
+
+// Collects the keys passed to load() during one tick of the event loop, and
+// fetches the rows for all of them with a few IN-list queries instead of one
+// query per key. The SQL template has a single ? parameter marker, which is
+// expanded to one marker per key, e.g.
+//
+//   SELECT * FROM MY_TABLE WHERE ID IN (?)
+//
+// The keys are split into chunks of at most maxBatch keys, which are queried
+// in parallel on connections from the pool, and the rows returned are routed
+// back to the callers by the value of their key column. Keys are matched by
+// their string form, since the driver returns BIGINT and DECIMAL columns as
+// strings: load(42) gets the rows whose key column is 42 or '42'.
+class BatchLoader {
+
+  constructor(pool, sqlTemplate, options = {}) {
+    if (typeof sqlTemplate !== 'string' || typeof options !== 'object' || options === null) {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to pool.batchLoader({string}, {object}).');
+    }
+
+    const templateParts = sqlTemplate.split('?');
+    if (templateParts.length !== 2) {
+      throw new TypeError('[node-odbc]: The SQL template passed to pool.batchLoader must have exactly one ? parameter marker.');
+    }
+
+    if (typeof options.key !== 'string' && typeof options.key !== 'function') {
+      throw new TypeError('[node-odbc]: pool.batchLoader options: .key must be a column name or a function returning the key of a row.');
+    }
+
+    const maxBatch = options.maxBatch !== undefined ? options.maxBatch : MAX_BATCH_DEFAULT;
+    if (!Number.isInteger(maxBatch) || maxBatch <= 0) {
+      throw new TypeError('[node-odbc]: pool.batchLoader options: .maxBatch must be an integer greater than 0.');
+    }
+
+    this.pool = pool;
+    this.templateParts = templateParts;
+    this.keyOf = typeof options.key === 'function' ? options.key : (row) => row[options.key];
+    this.maxBatch = maxBatch;
+
+    // SQL for each size of IN list, so the same few SQL strings are reused
+    // and hit the statement caches of the connections
+    this.sqlBySize = new Map();
+
+    // String(key) => { key, promise, resolve, reject } for the batch being
+    // collected
+    this.batch = null;
+  }
+
+  /**
+   * Loads the rows for a key, batched with the other keys loaded in the same tick.
+   * @param {*} key - The key to look up.
+   * @returns {Promise} - Resolves with the array of rows whose key column has the same string form
+   * as key.
+   */
+  load(key) {
+    if (this.batch === null) {
+      this.batch = new Map();
+      // dispatch after the promise jobs queued in this tick have run, so that
+      // keys loaded after an await in the same tick join the batch
+      Promise.resolve().then(() => process.nextTick(() => this.dispatch()));
+    }
+
+    const batchKey = String(key);
+    let request = this.batch.get(batchKey);
+    if (request === undefined) {
+      request = { key };
+      request.promise = new Promise((resolve, reject) => {
+        request.resolve = resolve;
+        request.reject = reject;
+      });
+      this.batch.set(batchKey, request);
+    }
+    return request.promise;
+  }
+
+  /**
+   * Loads the rows for each of the keys.
+   * @param {Array} keys - The keys to look up.
+   * @returns {Promise} - Resolves with an array holding the array of rows of each key.
+   */
+  loadMany(keys) {
+    return Promise.all(keys.map((key) => this.load(key)));
+  }
+
+  // The SQL for an IN list of size markers
+  sql(size) {
+    let sql = this.sqlBySize.get(size);
+    if (sql === undefined) {
+      sql = `${this.templateParts[0]}${new Array(size).fill('?').join(', ')}${this.templateParts[1]}`;
+      this.sqlBySize.set(size, sql);
+    }
+    return sql;
+  }
+
+  dispatch() {
+    const batch = this.batch;
+    this.batch = null;
+
+    const keys = [...batch.keys()];
+    for (let start = 0; start < keys.length; start += this.maxBatch) {
+      const chunk = keys.slice(start, start + this.maxBatch);
+
+      // round the size of the IN list up to a power of two (capped by
+      // maxBatch) by repeating the last key, which bounds the number of
+      // distinct SQL strings to about log2(maxBatch)
+      let size = 1;
+      while (size < chunk.length) {
+        size *= 2;
+      }
+      size = Math.min(size, this.maxBatch);
+      const parameters = chunk.map((batchKey) => batch.get(batchKey).key);
+      while (parameters.length < size) {
+        parameters.push(parameters[parameters.length - 1]);
+      }
+
+      this.pool.query(this.sql(size), parameters).then((result) => {
+        const rowsByKey = new Map();
+        for (const row of result) {
+          const key = String(this.keyOf(row));
+          let rows = rowsByKey.get(key);
+          if (rows === undefined) {
+            rows = [];
+            rowsByKey.set(key, rows);
+          }
+          rows.push(row);
+        }
+        chunk.forEach((batchKey) => {
+          batch.get(batchKey).resolve(rowsByKey.get(batchKey) || []);
+        });
+      }, (error) => {
+        chunk.forEach((batchKey) => {
+          batch.get(batchKey).reject(error);
+        });
+      });
+    }
+  }
+}
+
+module.exports.BatchLoader = BatchLoader;
@@ -0,0 +1,161 @@
+const { WaiterQueue } = require('./WaiterQueue');
+
+const ALGORITHM_DEFAULT = 'gradient';
+const INITIAL_LIMIT_DEFAULT = 20;
+const MIN_LIMIT_DEFAULT = 1;
+const MAX_LIMIT_DEFAULT = 1000;
+const MAX_QUEUE_DEFAULT = Number.MAX_SAFE_INTEGER;
+// gradient
+const TOLERANCE_DEFAULT = 1.5;
+const SMOOTHING_DEFAULT = 0.2;
+const LONG_WINDOW = 600;
+const WARMUP_SAMPLES = 10;
+// aimd
+const BACKOFF_RATIO_DEFAULT = 0.9;
+const LATENCY_THRESHOLD_DEFAULT = 1000;
+
+// Limits how many queries a pool runs at the same time, adjusting the limit
+// from the latency of the queries the way TCP congestion control adjusts its
+// window, so that a database that slows down gets less work instead of more
+// connections. Work over the limit waits in a queue, or is rejected right away
+// once maxQueue requests are waiting.
+//
+// 'gradient': compares the latency of each query with a long-term average.
+// While queries are as fast as usual, the limit grows by about its square
+// root; once they get slower than the average by more than tolerance, the
+// limit shrinks in proportion.
+//
+// 'aimd': grows the limit by one for each query faster than
+// latencyThresholdMs (while the limit is being used), and multiplies it by
+// backoffRatio when one is slower, once for all the queries that were already
+// running when it backed off.
+class ConcurrencyLimiter {
+
+  constructor(options = {}) {
+    this.algorithm = options.algorithm !== undefined ? options.algorithm : ALGORITHM_DEFAULT;
+    if (this.algorithm !== 'gradient' && this.algorithm !== 'aimd') {
+      throw new TypeError('Pool configuration "concurrencyLimit.algorithm" must be "gradient" or "aimd"');
+    }
+    this.minLimit = options.minLimit !== undefined ? options.minLimit : MIN_LIMIT_DEFAULT;
+    this.maxLimit = options.maxLimit !== undefined ? options.maxLimit : MAX_LIMIT_DEFAULT;
+    this.limit = options.initialLimit !== undefined ? options.initialLimit : Math.min(INITIAL_LIMIT_DEFAULT, this.maxLimit);
+    this.maxQueue = options.maxQueue !== undefined ? options.maxQueue : MAX_QUEUE_DEFAULT;
+    if (!(this.minLimit >= 1 && this.minLimit <= this.limit && this.limit <= this.maxLimit)) {
+      throw new RangeError('Pool configuration "concurrencyLimit" must have 1 <= minLimit <= initialLimit <= maxLimit');
+    }
+
+    this.tolerance = options.tolerance !== undefined ? options.tolerance : TOLERANCE_DEFAULT;
+    this.smoothing = options.smoothing !== undefined ? options.smoothing : SMOOTHING_DEFAULT;
+    this.backoffRatio = options.backoffRatio !== undefined ? options.backoffRatio : BACKOFF_RATIO_DEFAULT;
+    this.latencyThresholdMs = options.latencyThresholdMs !== undefined ? options.latencyThresholdMs : LATENCY_THRESHOLD_DEFAULT;
+
+    // the long-term average latency of the gradient algorithm
+    this.longLatency = 0;
+    this.samples = 0;
+
+    // incremented by every backoff of the aimd algorithm
+    this.epoch = 0;
+
+    this.inFlight = 0;
+    this.queue = new WaiterQueue();
+    this.rejectedCount = 0;
+  }
+
+  /**
+   * Waits until one more query can run.
+   * @returns {Promise} - Resolves with a release(latencyMs, ignore) function to call once the
+   * query is done, or rejects if too many queries are already waiting.
+   */
+  acquire() {
+    if (this.inFlight < Math.floor(this.limit)) {
+      this.inFlight++;
+      return Promise.resolve(this.releaser());
+    }
+    if (this.queue.length >= this.maxQueue) {
+      this.rejectedCount++;
+      return Promise.reject(new Error(`[node-odbc]: Query rejected by the concurrency limit of the pool (${this.inFlight} queries running, ${this.queue.length} waiting).`));
+    }
+    return new Promise((resolve) => {
+      this.queue.push({
+        cancelled: false,
+        settle: () => resolve(this.releaser()),
+      });
+    });
+  }
+
+  // A function releasing one query's worth of the limit, once. Queries that
+  // failed pass ignore, so that errors unrelated to load (bad SQL) don't
+  // change the limit.
+  releaser() {
+    let released = false;
+    const { epoch } = this;
+    return (latencyMs, ignore = false) => {
+      if (released) {
+        return;
+      }
+      released = true;
+      if (!ignore) {
+        this.update(latencyMs, epoch);
+      }
+      this.inFlight--;
+      this.drain();
+    };
+  }
+
+  drain() {
+    while (this.inFlight < Math.floor(this.limit) && this.queue.length > 0) {
+      this.inFlight++;
+      this.queue.shift().settle();
+    }
+  }
+
+  update(latencyMs, epoch) {
+    if (this.algorithm === 'aimd') {
+      if (latencyMs > this.latencyThresholdMs) {
+        if (epoch === this.epoch) {
+          this.limit = Math.max(this.minLimit, Math.floor(this.limit * this.backoffRatio));
+          this.epoch++;
+        }
+      } else if (this.inFlight * 2 >= this.limit) {
+        this.limit = Math.min(this.maxLimit, this.limit + 1);
+      }
+      return;
+    }
+
+    // gradient: a simple average while warming up, then an exponential
+    // average over about LONG_WINDOW samples
+    this.samples++;
+    if (this.samples <= WARMUP_SAMPLES) {
+      this.longLatency += (latencyMs - this.longLatency) / this.samples;
+    } else {
+      this.longLatency += (latencyMs - this.longLatency) * (2 / (LONG_WINDOW + 1));
+    }
+    // let the average come down quickly after a period of high latency
+    if (this.longLatency / latencyMs > 2) {
+      this.longLatency *= 0.95;
+    }
+
+    const gradient = Math.max(0.5, Math.min(1, (this.tolerance * this.longLatency) / Math.max(latencyMs, 0.001)));
+    const newLimit = this.limit * gradient + Math.sqrt(this.limit);
+    // don't grow a limit that isn't being used, but still shrink it when
+    // queries slow down
+    if (newLimit > this.limit && this.inFlight < this.limit / 2) {
+      return;
+    }
+    this.limit = Math.min(this.maxLimit, Math.max(
+      this.minLimit,
+      this.limit * (1 - this.smoothing) + newLimit * this.smoothing,
+    ));
+  }
+
+  stats() {
+    return {
+      limit: Math.floor(this.limit),
+      inFlight: this.inFlight,
+      queued: this.queue.length,
+      rejected: this.rejectedCount,
+    };
+  }
+}
+
+module.exports.ConcurrencyLimiter = ConcurrencyLimiter;
@@ -1,5 +1,37 @@
 const { Statement } = require('./Statement');
 const { Cursor }    = require('./Cursor');
+const { wrapStreamParameters } = require('./dataAtExecution');
+
+// The properties of the options object passed to query. An object passed in
+// place of the parameters with any other property is taken to hold the values
+// of :name parameter markers instead.
+const QUERY_OPTIONS = [
+  'cursor',
+  'fetchSize',
+  'timeout',
+  'initialBufferSize',
+  'rowBinding',
+  'latin1',
+  'intern',
+  // only used by pool.query
+  'cache',
+  'idempotent',
+  'readOnly',
+  'priority',
+  'tenant',
+];
+
+function isQueryOptions(object) {
+  return Object.keys(object).every((key) => QUERY_OPTIONS.includes(key));
+}
+
+// The names insertColumns puts into the SQL it builds: regular identifiers,
+// which the database folds to its own case as usual, or identifiers already
+// delimited with double quotes. The table name can be qualified by a schema
+// (and a catalog) with dots.
+const IDENTIFIER = '(?:[\\p{L}_][\\p{L}\\p{N}_$#@]*|"(?:[^"]|"")+")';
+const COLUMN_NAME_PATTERN = new RegExp(`^${IDENTIFIER}$`, 'u');
+const TABLE_NAME_PATTERN = new RegExp(`^${IDENTIFIER}(?:\\.${IDENTIFIER}){0,2}$`, 'u');
 
 class Connection {
 
@@ -71,7 +103,10 @@ class Connection {
 
     if (typeof options === 'undefined')
     {
-      if (typeof parameters === 'object' && parameters !== null && !Array.isArray(parameters))
+      if (
+        typeof parameters === 'object' && parameters !== null &&
+        !Array.isArray(parameters) && isQueryOptions(parameters)
+      )
       {
         options = parameters;
         parameters = null;
@@ -87,7 +122,7 @@ class Connection {
 
     if (
       typeof sql !== 'string' ||
-      (parameters !== null && !Array.isArray(parameters)) ||
+      (parameters !== null && typeof parameters !== 'object') ||
       (options !== null && typeof options !== 'object') ||
       (typeof callback !== 'function' && typeof callback !== 'undefined')
     ) 
@@ -95,6 +130,8 @@ class Connection {
       throw new TypeError('[node-odbc]: Incorrect function signature for call to connection.query({string}, {array}[optional], {object}[optional], {function}[optional]).');
     }
 
+    parameters = wrapStreamParameters(parameters);
+
     if (typeof callback !== 'function') {
       if (!this.odbcConnection)
       {
@@ -212,6 +249,131 @@ class Connection {
     }
   }
 
+  /**
+   * Creates a Statement with the SQL already prepared, saving the separate trip to the thread
+   * pool of calling statement.prepare() on a new statement.
+   * @param {string} sql - The SQL statement template to prepare.
+   * @param {function} [callback] - The callback function that returns the Statement. If omitted, uses a Promise.
+   * @returns {undefined|Promise}
+   */
+  prepare(sql, callback = undefined) {
+    if (typeof sql !== 'string'
+    || (typeof callback !== 'function' && typeof callback !== 'undefined')) {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to connection.prepare({string}, {function}[optional]).');
+    }
+
+    // promise...
+    if (callback === undefined) {
+      if (!this.odbcConnection)
+      {
+        throw new Error(Connection.CONNECTION_CLOSED_ERROR);
+      }
+      return new Promise((resolve, reject) => {
+        this.odbcConnection.prepare(sql, (error, odbcStatement) => {
+          if (error) {
+            reject(error);
+          } else {
+            resolve(new Statement(odbcStatement));
+          }
+        });
+      });
+    }
+
+    // ...or callback
+    if (!this.odbcConnection) {
+      callback(new Error(Connection.CONNECTION_CLOSED_ERROR));
+    } else {
+      this.odbcConnection.prepare(sql, (error, odbcStatement) => {
+        if (error) { return callback(error, null); }
+
+        callback(null, new Statement(odbcStatement));
+      });
+    }
+  }
+
+  /**
+   * Inserts rows from columns of values held in TypedArrays. The memory of
+   * each TypedArray is bound as an array of parameters, so the values are
+   * never copied or turned into JavaScript values, and as many rows as fit in
+   * options.batchMemory bytes are inserted with each execution. With autocommit on, the batches
+   * run in a single transaction, so either every row is inserted or none is.
+   * @param {string} table - The table to insert the rows into.
+   * @param {object} columns - The columns to insert, as { columnName: TypedArray }, all of the same length.
+   * @param {object} [options] - Optional options: batchMemory, the number of bytes of values inserted with each execution.
+   * @param {function} [callback] - The callback function that returns the number of rows inserted. If omitted, uses a Promise.
+   * @returns {undefined|Promise}
+   */
+  insertColumns(table, columns, opts = undefined, cb = undefined) {
+    let callback = cb;
+    let options = opts;
+
+    if (typeof callback === 'undefined' && typeof options === 'function') {
+      callback = options;
+      options = undefined;
+    }
+
+    if (typeof options === 'undefined') {
+      options = {};
+    }
+
+    if (typeof table !== 'string'
+    || typeof columns !== 'object' || columns === null || Array.isArray(columns)
+    || typeof options !== 'object' || options === null
+    || (typeof callback !== 'function' && typeof callback !== 'undefined')) {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to connection.insertColumns({string}, {object}, {object}[optional], {function}[optional]).');
+    }
+
+    if (!TABLE_NAME_PATTERN.test(table)) {
+      throw new TypeError(`[node-odbc]: Table name ${table} passed to connection.insertColumns is not a valid identifier.`);
+    }
+
+    const columnNames = Object.keys(columns);
+    if (columnNames.length === 0) {
+      throw new TypeError('[node-odbc]: connection.insertColumns must be passed at least one column.');
+    }
+
+    const typedArrays = columnNames.map((columnName) => {
+      if (!COLUMN_NAME_PATTERN.test(columnName)) {
+        throw new TypeError(`[node-odbc]: Column name ${columnName} passed to connection.insertColumns is not a valid identifier.`);
+      }
+      if (!ArrayBuffer.isView(columns[columnName]) || columns[columnName] instanceof DataView) {
+        throw new TypeError(`[node-odbc]: Column ${columnName} passed to connection.insertColumns is not a TypedArray.`);
+      }
+      return columns[columnName];
+    });
+
+    if (typeof options.batchMemory !== 'undefined'
+    && (typeof options.batchMemory !== 'number' || options.batchMemory <= 0)) {
+      throw new TypeError('[node-odbc]: connection.insertColumns options: .batchMemory must be a number greater than 0.');
+    }
+
+    const sql = `INSERT INTO ${table} (${columnNames.join(', ')}) VALUES (${columnNames.map(() => '?').join(', ')})`;
+
+    // promise...
+    if (callback === undefined) {
+      if (!this.odbcConnection)
+      {
+        throw new Error(Connection.CONNECTION_CLOSED_ERROR);
+      }
+      return new Promise((resolve, reject) => {
+        this.odbcConnection.insertColumns(sql, typedArrays, options.batchMemory, (error, result) => {
+          if (error) {
+            reject(error);
+          } else {
+            resolve(result);
+          }
+        });
+      });
+    }
+
+    // ...or callback
+    if (!this.odbcConnection) {
+      callback(new Error(Connection.CONNECTION_CLOSED_ERROR));
+    } else {
+      this.odbcConnection.insertColumns(sql, typedArrays, options.batchMemory, callback);
+    }
+  }
+
   // TODO: Write the documentation
   /**
    *
@@ -516,6 +678,37 @@ class Connection {
       this.odbcConnection.rollback(callback);
     }
   }
+
+  /**
+   * Asynchronously undoes the changes made to the state of the connection through this object:
+   * rolls back a transaction that is still open (turning autocommit back on), and restores the
+   * isolation level the connection started with. Doesn't call the driver if nothing changed.
+   * @param {function} [callback] - Callback function. If not passed, a Promise will be returned.
+   */
+  resetState(callback = undefined) {
+    if (callback === undefined) {
+      if (!this.odbcConnection)
+      {
+        throw new Error(Connection.CONNECTION_CLOSED_ERROR);
+      }
+      return new Promise((resolve, reject) => {
+        this.odbcConnection.resetState((error) => {
+          if (error) {
+            reject(error);
+          } else {
+            resolve();
+          }
+        });
+      });
+    }
+
+    if (!this.odbcConnection) {
+      callback(new Error(Connection.CONNECTION_CLOSED_ERROR));
+    } else {
+      this.odbcConnection.resetState(callback);
+    }
+  }
 }
 
 module.exports.Connection = Connection;
+module.exports.isQueryOptions = isQueryOptions;
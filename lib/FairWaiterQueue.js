@@ -0,0 +1,131 @@
+const { WaiterQueue } = require('./WaiterQueue');
+
+// The queue of the work waiting for a connection from a Pool, shared between
+// priority classes in proportion to their weights, and within each class
+// between tenants in turn, so that a burst of work from one class or one
+// tenant can't hold up everyone else.
+//
+// Classes are scheduled with stride scheduling: each class has a pass that
+// grows by 1 / weight every time one of its waiters is served, and the next
+// waiter comes from the class with the lowest pass. A class with weight 10
+// gets ten waiters served for every one of a class with weight 1, as long as
+// both have work waiting, and a class that had nothing waiting doesn't get to
+// catch up on the turns it skipped. Waiters of the same tenant are served in
+// the order they came in, and waiters of tenants that isEligible rejects (the
+// ones at their concurrency limit) are skipped until it accepts them.
+class FairWaiterQueue {
+
+  constructor(weights, isEligible = () => true) {
+    // name => { weight, pass, length, tenants: Map of tenant => WaiterQueue, order, next }
+    this.classes = new Map();
+    Object.keys(weights).forEach((name) => {
+      const weight = weights[name];
+      if (typeof weight !== 'number' || weight <= 0) {
+        throw new TypeError(`Pool configuration "priorities.${name}" must be a number greater than 0`);
+      }
+      this.classes.set(name, {
+        weight,
+        pass: 0,
+        length: 0,
+        tenants: new Map(),
+        // the tenants with work waiting, in the order they take turns
+        order: [],
+        next: 0,
+      });
+    });
+    this.isEligible = isEligible;
+    // the pass of the class served last
+    this.virtualTime = 0;
+    this.length = 0;
+  }
+
+  has(priority) {
+    return this.classes.has(priority);
+  }
+
+  push(waiter) {
+    const workClass = this.classes.get(waiter.priority);
+    if (workClass.length === 0) {
+      workClass.pass = Math.max(workClass.pass, this.virtualTime);
+    }
+    let queue = workClass.tenants.get(waiter.tenant);
+    if (queue === undefined) {
+      queue = new WaiterQueue();
+      workClass.tenants.set(waiter.tenant, queue);
+      workClass.order.push(waiter.tenant);
+    }
+    queue.push(waiter);
+    waiter.queue = queue;
+    workClass.length++;
+    this.length++;
+  }
+
+  // removes and returns the waiter that should get the next connection, or
+  // undefined if every waiter belongs to a tenant that can't have one
+  shift() {
+    let chosen;
+    let chosenTenant;
+    this.classes.forEach((workClass) => {
+      if (workClass.length === 0 || (chosen !== undefined && workClass.pass >= chosen.pass)) {
+        return;
+      }
+      const tenant = this.eligibleTenant(workClass);
+      if (tenant !== undefined) {
+        chosen = workClass;
+        chosenTenant = tenant;
+      }
+    });
+    if (chosen === undefined) {
+      return undefined;
+    }
+
+    const queue = chosen.tenants.get(chosenTenant.tenant);
+    const waiter = queue.shift();
+    chosen.next = chosenTenant.index + 1;
+    if (queue.length === 0) {
+      this.removeTenant(chosen, chosenTenant.tenant);
+    }
+    chosen.length--;
+    this.length--;
+    this.virtualTime = chosen.pass;
+    chosen.pass += 1 / chosen.weight;
+    return waiter;
+  }
+
+  // the next tenant of the class whose turn it is and that can be served
+  eligibleTenant(workClass) {
+    const count = workClass.order.length;
+    for (let i = 0; i < count; i++) {
+      const index = (workClass.next + i) % count;
+      const tenant = workClass.order[index];
+      if (this.isEligible(tenant)) {
+        return { tenant, index };
+      }
+    }
+    return undefined;
+  }
+
+  removeTenant(workClass, tenant) {
+    const index = workClass.order.indexOf(tenant);
+    workClass.tenants.delete(tenant);
+    workClass.order.splice(index, 1);
+    if (workClass.next > index) {
+      workClass.next--;
+    }
+  }
+
+  cancel(waiter) {
+    if (waiter.cancelled) {
+      return;
+    }
+    const workClass = this.classes.get(waiter.priority);
+    waiter.queue.cancel(waiter);
+    if (waiter.queue.length === 0) {
+      this.removeTenant(workClass, waiter.tenant);
+    }
+    workClass.length--;
+    this.length--;
+  }
+}
+
+module.exports.FairWaiterQueue = FairWaiterQueue;
@@ -1,9 +1,18 @@
 const EventEmitter = require('events');
+const diagnosticsChannel = require('diagnostics_channel');
+const { performance } = require('perf_hooks');
 const async = require('async');
 const binary = require('@mapbox/node-pre-gyp');
 const path = require('path');
 
-const { Connection } = require('./Connection');
+const { Connection, isQueryOptions } = require('./Connection');
+const { BatchLoader } = require('./BatchLoader');
+const { QueryCache, resultMetadata, defineResultMetadata } = require('./QueryCache');
+const { FairWaiterQueue } = require('./FairWaiterQueue');
+const { TimerWheel } = require('./TimerWheel');
+const { Histogram } = require('./Histogram');
+const { ConcurrencyLimiter } = require('./ConcurrencyLimiter');
+const { RetryPolicy, isConnectionError } = require('./RetryPolicy');
 
 const bindingPath = binary.find(path.resolve(path.join(__dirname, '../package.json')));
 
@@ -18,35 +27,161 @@ const CONNECTION_TIMEOUT_DEFAULT = 0;
 const LOGIN_TIMEOUT_DEFAULT = 0;
 const FETCH_ARRAY_DEFAULT = false;
 const MAX_ACTIVELY_CONNECTING = 1;
+const WARMUP_CONCURRENCY_DEFAULT = 10;
+const MIN_READY_SIZE_DEFAULT = 1;
+const IDLE_TIMEOUT_DEFAULT = 0;
+const MAX_LIFETIME_DEFAULT = 0;
+// connections reach their maximum lifetime up to this fraction of it early,
+// so that connections opened together aren't all reopened together
+const MAX_LIFETIME_JITTER = 0.1;
+const CHECK_CONNECTION_DEAD_DEFAULT = false;
+const VALIDATE_IDLE_DEFAULT = 0;
+const KEEPALIVE_DEFAULT = 0;
+const RESET_ON_RELEASE_DEFAULT = true;
+const STATS_INTERVAL_DEFAULT = 10000;
 
-// A queue for tracking the connections 
+// Snapshots of pool.stats() are published here every statsIntervalMs, as
+// { pool, stats }, while the channel has subscribers
+const statsChannel = diagnosticsChannel.channel('odbc:pool:stats');
+const TIMER_WHEEL_TICK = 1000;
+const TIMER_WHEEL_TICK_MIN = 10;
+const COALESCE_DEFAULT = false;
+const READ_ONLY_DEFAULT = false;
+const PRIORITY_DEFAULT = 'default';
+const TENANT_LIMIT_DEFAULT = Number.MAX_SAFE_INTEGER;
+const ACQUIRE_TIMEOUT_DEFAULT = 0;
+const MAX_WAITING_DEFAULT = Number.MAX_SAFE_INTEGER;
+
+// Only statements that read can safely share the results of another
+// execution. Some SELECT and WITH statements write, or return something new
+// every time they run, so any statement mentioning one of the ways they do
+// that isn't shared: data change statements (in a WITH, or in FINAL TABLE,
+// NEW TABLE and OLD TABLE), SELECT ... INTO, SELECT ... FOR UPDATE, and
+// sequence values. Mentions in string literals or names are left out too,
+// which only means those statements run on their own.
+const COALESCABLE_SQL = /^\s*(SELECT|WITH)\b/i;
+const VOLATILE_SQL = /\b(INSERT|UPDATE|DELETE|MERGE|INTO|NEXTVAL|NEXT\s+VALUE\s+FOR|PREVIOUS\s+VALUE\s+FOR|(FINAL|NEW|OLD)\s+TABLE)\b/i;
+
+function isCoalescableValue(value) {
+  return value === null
+    || typeof value === 'number'
+    || typeof value === 'string'
+    || typeof value === 'boolean'
+    || Buffer.isBuffer(value);
+}
+
+// Whether all of the parameters of a query can be compared by value, unlike
+// streams, which are also used up by the first execution they are sent with
+function hasComparableParameters(parameters) {
+  if (parameters !== null && typeof parameters === 'object') {
+    const values = Array.isArray(parameters) ? parameters : Object.values(parameters);
+    return values.every((value) => isCoalescableValue(value) || (
+      value !== null
+      && typeof value === 'object'
+      && isCoalescableValue(value.value)
+    ));
+  }
+  return parameters === null || typeof parameters === 'undefined';
+}
+
+// The SQL, parameters, and options of a query serialized together, or
+// undefined if there are parameters that can't be compared by value, like
+// streams.
+function queryKey(sql, parameters, options) {
+  if (!hasComparableParameters(parameters)) {
+    return undefined;
+  }
+  return JSON.stringify([sql, parameters, options]);
+}
+
+// The default key of coalesced queries, or undefined (meaning the query is run
+// on its own) for statements that aren't plain reads.
+function defaultCoalesceKey(sql, parameters, options) {
+  if (typeof sql !== 'string' || !COALESCABLE_SQL.test(sql) || VOLATILE_SQL.test(sql)) {
+    return undefined;
+  }
+  return queryKey(sql, parameters, options);
+}
+
+// The error that work waiting for a connection fails with when it is aborted
+function abortError(signal) {
+  if (signal.reason !== undefined) {
+    return signal.reason;
+  }
+  const error = new Error('The operation was aborted');
+  error.name = 'AbortError';
+  return error;
+}
+
+// Fails or completes a call to connect(), with its callback or Promise
+function settleWork(callback, error, connection) {
+  if (typeof callback === 'function') {
+    return callback(error, connection);
+  }
+  return error ? Promise.reject(error) : Promise.resolve(connection);
+}
+
+function isCursorQuery(options) {
+  return options !== null
+    && typeof options === 'object'
+    && (
+      Object.prototype.hasOwnProperty.call(options, 'fetchSize')
+      || Object.prototype.hasOwnProperty.call(options, 'cursor')
+    );
+}
+
+// Calls back with the outcome of a Promise, or returns the Promise if there is
+// no callback
+function settle(promise, callback) {
+  if (typeof callback !== 'function') {
+    return promise;
+  }
+  promise.then((result) => {
+    process.nextTick(() => {
+      callback(null, result);
+    });
+  }, (error) => {
+    process.nextTick(() => {
+      callback(error, undefined);
+    });
+  });
+  return undefined;
+}
+
+// A queue of the connections a pool is waiting to open, which opens at most
+// a limited number of them at the same time. Each queued connection carries
+// its own limit, so that the connections opened when the pool is initialized
+// can be opened with more concurrency than the ones opened on demand.
 class ConnectionQueue
 {
-  static queuedConnections = [];
-  static activelyConnectingCount = 0;
-  static maxActivelyConnecting = MAX_ACTIVELY_CONNECTING;
+  constructor(pool)
+  {
+    this.pool = pool;
+    this.queuedConnections = [];
+    this.activelyConnectingCount = 0;
+  }
 
-  static enqueue = async function(pool, promiseGenerator, configObject)
+  enqueue(promiseGenerator, configObject, maxActivelyConnecting)
   {
-      ConnectionQueue.queuedConnections.push({
-          pool,
-          promiseGenerator,
-          configObject
-      });
-      ConnectionQueue.dequeue();
-      return;
+    this.queuedConnections.push({
+      pool: this.pool,
+      promiseGenerator,
+      configObject,
+      maxActivelyConnecting,
+    });
+    this.dequeue();
   }
 
-  static dequeue = async function()
+  async dequeue()
   {
-    if (this.activelyConnectingCount >= this.maxActivelyConnecting) {
+    const item = this.queuedConnections[0];
+    if (!item || this.activelyConnectingCount >= item.maxActivelyConnecting) {
       return;
     }
-    const item = this.queuedConnections.shift();
-    if (!item) {
-      return;
-    }
-    ConnectionQueue.activelyConnectingCount++;
+    this.queuedConnections.shift();
+    this.activelyConnectingCount++;
+    // start the next connection as well, if its limit allows
+    this.dequeue();
     try {
       await item.promiseGenerator(item.configObject);
     } catch (error) {
@@ -54,9 +189,8 @@ class ConnectionQueue
       // "connectionError" event. Error thrown and caught here simply to resolve
       // the promise generated by the promiseGenerator.
     }
-    ConnectionQueue.activelyConnectingCount--;
-    ConnectionQueue.dequeue();
-    return;
+    this.activelyConnectingCount--;
+    this.dequeue();
   }
 }
 
@@ -65,11 +199,27 @@ class Pool {
   constructor(connectionString) {
 
     this.connectionConfig = {};
-    this.waitingConnectionWork = [];
     this.isOpen = false;
     this.freeConnections = [];
     this.connectionsBeingCreatedCount = 0;
     this.poolSize = 0;
+    this.connectionQueue = new ConnectionQueue(this);
+
+    // key => Promise of the result of each query being run, for coalescing
+    this.inFlightQueries = new Map();
+    this.coalescedQueryCount = 0;
+    this.coalescableQueryCount = 0;
+
+    // Statistics reported by stats()
+    this.acquireWait = new Histogram();
+    this.queryDuration = new Histogram();
+    this.connectFailureCount = 0;
+    this.acquireTimeoutCount = 0;
+    this.acquireRejectedCount = 0;
+    this.retryCount = 0;
+
+    // tenant => the number of connections it has checked out
+    this.tenantConnectionCounts = new Map();
 
     // Keeps track of when connections have sucessfully connected
     this.connectionEmitter = new EventEmitter();
@@ -77,12 +227,20 @@ class Pool {
     // Fires when a connection has been made
     this.connectionEmitter.on('connected', (connection) => {
 
+      // A connection that has outlived maxLifetimeMs was returned to the pool,
+      // so close it instead of handing it out again
+      if (connection.expired)
+      {
+        this.retireConnection(connection);
+        return;
+      }
+
       // A connection has finished connecting, but there is some waiting call
-      // to connect() that is waiting for a connection. shift() that work from
-      // the front of the waitingConnectionWork queue, then either call the
-      // callback function provided by the user, or resolve the Promise that was
-      // returned to the user.
-      let connectionWork = this.waitingConnectionWork.shift();
+      // to connect() that is waiting for a connection. shift() the work that
+      // has waited the longest from the front of the waitingConnectionWork
+      // queue, then either call the callback function provided by the user,
+      // or resolve the Promise that was returned to the user.
+      const connectionWork = this.waitingConnectionWork.shift();
 
       // A connection finished connecting, and there was no work waiting for
       // that connection to be made. Simply add it to the array of
@@ -90,44 +248,23 @@ class Pool {
       // retrieved from there.
       if (typeof connectionWork == 'undefined')
       {
-        this.freeConnections.push(connection);
+        this.addFreeConnection(connection);
         return;
       }
 
-      // If the user passed a callback function, then call the function with
-      // no error in the first parameter and the connection in the second
-      // parameter
-      if (typeof connectionWork == 'function')
-      {
-        return connectionWork(null, connection);
-      } 
-
-      // If the user didn't pass a callback function, we returned a promise to
-      // them. Resolve that promise with the connection that was just created.
-      // Promise (stored resolve function)
-      return connectionWork.resolveFunction(connection);
+      return connectionWork.settle(null, connection);
     });
 
     // Fires when a connection has errored. If there is no work waiting, then
     // the pool will simply be empty until the next time work is requested, at
     // which point there WILL be waiting work and they will get an error.
     this.connectionEmitter.on('connectionError', (error) => {
-      let connectionWork = this.waitingConnectionWork.shift();
+      const connectionWork = this.waitingConnectionWork.shift();
       if (typeof connectionWork == 'undefined')
       {
         return;
       }
-      // If the user passed a callback function, then call the function with
-      // the error in the first parameter
-      if (typeof connectionWork == 'function')
-      {
-        return connectionWork(error, undefined);
-      // If the user didn't pass a callback function, we returned a promise to
-      // them. Reject that promise with the generated error
-      } else {
-        // Promise (stored resolve function)
-        return connectionWork.rejectFunction(error);
-      }
+      return connectionWork.settle(error, undefined);
     });
 
     // connectionString is a string, so use defaults for all of the
@@ -143,6 +280,29 @@ class Pool {
       this.connectionConfig.connectionTimeout = CONNECTION_TIMEOUT_DEFAULT;
       this.connectionConfig.loginTimeout = LOGIN_TIMEOUT_DEFAULT;
       this.connectionConfig.fetchArray = FETCH_ARRAY_DEFAULT;
+      this.connectionConfig.readOnly = READ_ONLY_DEFAULT;
+      this.coalesce = COALESCE_DEFAULT;
+      this.coalesceKey = defaultCoalesceKey;
+      this.cache = null;
+      this.acquireTimeoutMs = ACQUIRE_TIMEOUT_DEFAULT;
+      this.maxWaiting = MAX_WAITING_DEFAULT;
+      this.maxActivelyConnecting = MAX_ACTIVELY_CONNECTING;
+      this.warmupConcurrency = WARMUP_CONCURRENCY_DEFAULT;
+      this.minReadySize = MIN_READY_SIZE_DEFAULT;
+      this.minSize = this.initialSize;
+      this.idleTimeoutMs = IDLE_TIMEOUT_DEFAULT;
+      this.maxLifetimeMs = MAX_LIFETIME_DEFAULT;
+      this.checkConnectionDead = CHECK_CONNECTION_DEAD_DEFAULT;
+      this.validationQuery = null;
+      this.validateIdleMs = VALIDATE_IDLE_DEFAULT;
+      this.keepaliveMs = KEEPALIVE_DEFAULT;
+      this.resetOnRelease = RESET_ON_RELEASE_DEFAULT;
+      this.statsIntervalMs = STATS_INTERVAL_DEFAULT;
+      this.limiter = null;
+      this.retryPolicy = null;
+      this.priorities = { [PRIORITY_DEFAULT]: 1 };
+      this.tenantLimit = TENANT_LIMIT_DEFAULT;
+      this.tenantLimits = {};
     }
     // connectionString is an object, so ensure that connectionString is a
     // property on that object and then copy over any configuration options.
@@ -179,78 +339,182 @@ class Pool {
       // fetchArray
       this.connectionConfig.fetchArray = configObject.fetchArray || FETCH_ARRAY_DEFAULT; 
 
-      // connectingQueueMax
-      // unlike other configuration values, this one is set statically on the
-      // ConnectionQueue object and not on the Pool intance
-      if (configObject.maxActivelyConnecting !== undefined)
-      {
-        ConnectionQueue.maxActivelyConnecting = configObject.maxActivelyConnecting
+      // readOnly
+      this.connectionConfig.readOnly = configObject.readOnly !== undefined ? configObject.readOnly : READ_ONLY_DEFAULT;
+
+      // coalesce
+      this.coalesce = configObject.coalesce !== undefined ? configObject.coalesce : COALESCE_DEFAULT;
+
+      // coalesceKey
+      if (configObject.coalesceKey !== undefined && typeof configObject.coalesceKey !== 'function') {
+        throw new TypeError('Pool configuration "coalesceKey" must be a function');
+      }
+      this.coalesceKey = configObject.coalesceKey || defaultCoalesceKey;
+
+      // cache
+      if (configObject.cache) {
+        this.cache = new QueryCache(configObject.cache === true ? {} : configObject.cache);
+      } else {
+        this.cache = null;
+      }
+
+      // acquireTimeoutMs
+      this.acquireTimeoutMs = configObject.acquireTimeoutMs !== undefined ? configObject.acquireTimeoutMs : ACQUIRE_TIMEOUT_DEFAULT;
+
+      // maxWaiting
+      this.maxWaiting = configObject.maxWaiting !== undefined ? configObject.maxWaiting : MAX_WAITING_DEFAULT;
+
+      // maxActivelyConnecting
+      this.maxActivelyConnecting = configObject.maxActivelyConnecting !== undefined ? configObject.maxActivelyConnecting : MAX_ACTIVELY_CONNECTING;
+
+      // warmupConcurrency
+      this.warmupConcurrency = configObject.warmupConcurrency !== undefined ? configObject.warmupConcurrency : WARMUP_CONCURRENCY_DEFAULT;
+
+      // minReadySize
+      this.minReadySize = configObject.minReadySize !== undefined ? configObject.minReadySize : MIN_READY_SIZE_DEFAULT;
+
+      // minSize
+      this.minSize = configObject.minSize !== undefined ? configObject.minSize : this.initialSize;
+
+      // idleTimeoutMs
+      this.idleTimeoutMs = configObject.idleTimeoutMs !== undefined ? configObject.idleTimeoutMs : IDLE_TIMEOUT_DEFAULT;
+
+      // maxLifetimeMs
+      this.maxLifetimeMs = configObject.maxLifetimeMs !== undefined ? configObject.maxLifetimeMs : MAX_LIFETIME_DEFAULT;
+
+      // checkConnectionDead
+      this.checkConnectionDead = configObject.checkConnectionDead !== undefined ? configObject.checkConnectionDead : CHECK_CONNECTION_DEAD_DEFAULT;
+
+      // validationQuery
+      if (configObject.validationQuery !== undefined && typeof configObject.validationQuery !== 'string') {
+        throw new TypeError('Pool configuration "validationQuery" must be a string');
+      }
+      this.validationQuery = configObject.validationQuery || null;
+
+      // validateIdleMs
+      this.validateIdleMs = configObject.validateIdleMs !== undefined ? configObject.validateIdleMs : VALIDATE_IDLE_DEFAULT;
+
+      // keepaliveMs
+      this.keepaliveMs = configObject.keepaliveMs !== undefined ? configObject.keepaliveMs : KEEPALIVE_DEFAULT;
+
+      // resetOnRelease
+      this.resetOnRelease = configObject.resetOnRelease !== undefined ? configObject.resetOnRelease : RESET_ON_RELEASE_DEFAULT;
+
+      // statsIntervalMs
+      this.statsIntervalMs = configObject.statsIntervalMs !== undefined ? configObject.statsIntervalMs : STATS_INTERVAL_DEFAULT;
+
+      // concurrencyLimit
+      if (configObject.concurrencyLimit) {
+        const limitOptions = configObject.concurrencyLimit === true ? {} : { ...configObject.concurrencyLimit };
+        // running more queries than there can be connections only makes them
+        // wait for connections
+        if (limitOptions.maxLimit === undefined && this.maxSize < MAX_SIZE_DEFAULT) {
+          limitOptions.maxLimit = this.maxSize;
+          if (limitOptions.initialLimit === undefined) {
+            limitOptions.initialLimit = Math.min(this.maxSize, this.initialSize) || 1;
+          }
+        }
+        this.limiter = new ConcurrencyLimiter(limitOptions);
+      } else {
+        this.limiter = null;
+      }
+
+      // retry
+      if (configObject.retry) {
+        this.retryPolicy = new RetryPolicy(configObject.retry === true ? {} : configObject.retry);
+      } else {
+        this.retryPolicy = null;
       }
+
+      // priorities
+      this.priorities = { [PRIORITY_DEFAULT]: 1, ...configObject.priorities };
+
+      // tenantLimit
+      this.tenantLimit = configObject.tenantLimit !== undefined ? configObject.tenantLimit : TENANT_LIMIT_DEFAULT;
+
+      // tenantLimits
+      this.tenantLimits = configObject.tenantLimits !== undefined ? configObject.tenantLimits : {};
     }
     // connectionString was neither a string nor and object, so throw an error.
     else
     {
       throw TypeError('Pool constructor must passed a connection string or a configuration object');
     }
+
+    // Work waiting for a connection is served by priority and tenant, and in
+    // the order it came in when neither is used
+    this.waitingConnectionWork = new FairWaiterQueue(
+      this.priorities,
+      (tenant) => this.isTenantEligible(tenant),
+    );
+
+    // One timer wheel closes the idle and aged connections of the pool, keeps
+    // idle connections alive, and publishes statistics, with
+    // a tick short enough for the timeouts configured
+    const timeouts = [this.idleTimeoutMs, this.maxLifetimeMs, this.keepaliveMs, this.statsIntervalMs].filter((timeout) => timeout > 0);
+    this.timerWheel = new TimerWheel(Math.max(
+      TIMER_WHEEL_TICK_MIN,
+      Math.min(TIMER_WHEEL_TICK, ...timeouts.map((timeout) => Math.floor(timeout / 4))),
+    ));
   }
 
   // returns a open connection, ready to use.
   // should overwrite the 'close' function of the connection, and rename it is 'nativeClose', so
   // that that close can still be called.
-  async connect(callback = undefined) {
+  async connect(opts = undefined, cb = undefined) {
 
-    let connection;
+    let options = opts;
+    let callback = cb;
+    if (typeof options === 'function' && typeof callback === 'undefined') {
+      callback = options;
+      options = undefined;
+    }
+    if (
+      (typeof options !== 'undefined' && (typeof options !== 'object' || options === null)) ||
+      (typeof callback !== 'undefined' && typeof callback !== 'function')
+    ) {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to pool.connect({object}[optional], {function}[optional]).');
+    }
 
-    if (this.freeConnections.length == 0) {
+    const acquireTimeoutMs = options && options.acquireTimeoutMs !== undefined ? options.acquireTimeoutMs : this.acquireTimeoutMs;
+    const signal = options ? options.signal : undefined;
+    const priority = options && options.priority !== undefined ? options.priority : PRIORITY_DEFAULT;
+    const tenant = options ? options.tenant : undefined;
+    const start = performance.now();
 
-      // If the number of connections waiting is more (shouldn't happen) or
-      // equal to the number of connections connecting, and the number of
-      // connections in the pool, in the process of connecting, and that will be
-      // added is less than the maximum number of allowable connections, then
-      // we will need to create MORE connections.
-      if (this.connectionsBeingCreatedCount <= this.waitingConnectionWork.length &&
-          this.poolSize + this.connectionsBeingCreatedCount + this.incrementSize <= this.maxSize)
-      {
-        this.increasePoolSize(this.incrementSize);
-      }
+    let connection;
 
-      // If no callback was provided when connect was called, we need to create
-      // a promise to return back. We also need to save off the resolve function
-      // of that promises callback, so that we can call it to resolve the
-      // function we returned
-      if (typeof callback == 'undefined') {
-        let resolveConnectionPromise;
-        let rejectConnectionPromise;
-
-        const promise = new Promise((resolve, reject) => {
-          resolveConnectionPromise = resolve;
-          rejectConnectionPromise = reject;
-        });
-        const promiseObj = {
-          promise: promise,
-          resolveFunction: resolveConnectionPromise,
-          rejectFunction: rejectConnectionPromise,
-        }
-        // push the promise onto the waitingConnectionWork queue, then return
-        // it to the user
-        this.waitingConnectionWork.push(promiseObj);
-        return promise;
-      }
-      // If a callback was provided, we can just add that to the
-      // waitingConnectionWork queue, then return undefined to the user. Their
-      // callback will execute when a connection is ready
-      else
-      {
-        this.waitingConnectionWork.push(callback)
-        return undefined;
-      }
+    if (!this.waitingConnectionWork.has(priority)) {
+      return settleWork(callback, new TypeError(`[node-odbc]: Unknown priority "${priority}" for a connection from the pool. The priorities of the pool are: ${Object.keys(this.priorities).join(', ')}.`), undefined);
     }
-    // Else, there was a free connection available for the user, so either
-    // return an immediately resolved promise, or call their callback
-    // immediately.
-    else
-    {
+
+    // The work was aborted before it even started waiting
+    if (signal && signal.aborted) {
+      return settleWork(callback, abortError(signal), undefined);
+    }
+
+    // Hand out a free connection, after making sure that it still works.
+    // Connections that don't are closed (and replaced, if work is waiting).
+    // Tenants that have all the connections they are allowed have to wait
+    // for one of theirs to be given back.
+    while (this.freeConnections.length > 0 && this.isTenantEligible(tenant)) {
       connection = this.freeConnections.pop();
+      this.cancelIdleTimers(connection);
+
+      if (
+        (this.checkConnectionDead && !connection.connected) ||
+        (
+          this.validationQuery &&
+          Date.now() - connection.idleSince >= this.validateIdleMs &&
+          !(await this.ping(connection))
+        )
+      ) {
+        this.retireConnection(connection);
+        continue;
+      }
+
+      this.acquireWait.record(performance.now() - start);
+      this.checkOut(connection, tenant);
 
       // promise...
       if (typeof callback === 'undefined') {
@@ -260,6 +524,90 @@ class Pool {
         return callback(null, connection);
       }
     }
+
+    // There are no free connections, so the work has to wait for one. If too
+    // much work is already waiting for a connection, fail right away instead
+    // of piling up work that would only time out
+    if (this.waitingConnectionWork.length >= this.maxWaiting) {
+      this.acquireRejectedCount++;
+      return settleWork(callback, new Error(`[node-odbc]: Too many requests (${this.maxWaiting}) are waiting for a connection from the pool.`), undefined);
+    }
+
+    // If the number of connections waiting is more (shouldn't happen) or
+    // equal to the number of connections connecting, and the number of
+    // connections in the pool, in the process of connecting, and that will be
+    // added is less than the maximum number of allowable connections, then
+    // we will need to create MORE connections. Work that waits because its
+    // tenant already has all the connections it is allowed can't use a new
+    // connection, so none is created for it.
+    if (this.isTenantEligible(tenant) &&
+        this.connectionsBeingCreatedCount <= this.waitingConnectionWork.length &&
+        this.poolSize + this.connectionsBeingCreatedCount + this.incrementSize <= this.maxSize)
+    {
+      this.increasePoolSize(this.incrementSize);
+    }
+
+    // If no callback was provided when connect was called, we need to create
+    // a promise to return back, which the work settles when a connection is
+    // handed to it. If a callback was provided, the work simply calls it,
+    // and undefined is returned to the user.
+    let promise;
+    let settle;
+    if (typeof callback == 'undefined') {
+      promise = new Promise((resolve, reject) => {
+        settle = (error, connection) => {
+          if (error) {
+            reject(error);
+          } else {
+            resolve(connection);
+          }
+        };
+      });
+    } else {
+      settle = callback;
+    }
+
+    const connectionWork = {
+      cancelled: false,
+      timer: undefined,
+      priority,
+      tenant,
+      settle: (error, connection) => {
+        if (connectionWork.timer) {
+          clearTimeout(connectionWork.timer);
+        }
+        if (signal) {
+          signal.removeEventListener('abort', onAbort);
+        }
+        if (!error) {
+          this.acquireWait.record(performance.now() - start);
+          this.checkOut(connection, tenant);
+        }
+        settle(error, connection);
+      },
+    };
+
+    // Work that times out or is aborted is taken out of the queue, so the
+    // connection goes to the next work waiting
+    const cancel = (error) => {
+      this.waitingConnectionWork.cancel(connectionWork);
+      connectionWork.settle(error, undefined);
+    };
+    const onAbort = () => {
+      cancel(abortError(signal));
+    };
+    if (acquireTimeoutMs > 0) {
+      connectionWork.timer = setTimeout(() => {
+        this.acquireTimeoutCount++;
+        cancel(new Error(`[node-odbc]: Timed out after ${acquireTimeoutMs} ms waiting for a connection from the pool.`));
+      }, acquireTimeoutMs);
+    }
+    if (signal) {
+      signal.addEventListener('abort', onAbort);
+    }
+
+    this.waitingConnectionWork.push(connectionWork);
+    return promise;
   };
 
   async query(sql, params, opts, cb) {
@@ -272,13 +620,8 @@ class Pool {
       if (typeof options === 'function')
       {
         callback = options;
-        if (typeof parameters === 'object' && !Array.isArray(parameters))
-        {
-          options = parameters;
-          parameters = null;
-        } else {
-          options = null;
-        }
+        // connection.query tells query options from named parameters
+        options = undefined;
       } else if (
         typeof options === 'undefined' &&
         typeof parameters === 'function')
@@ -289,46 +632,261 @@ class Pool {
       }
     }
 
-    if (typeof callback !== 'function') {
-      return new Promise((resolve, reject) => {
-        this.connect((error, connection) => {
-          if (error) {
-            reject(error);
-          }
+    // find the query options, which could have been passed in place of the
+    // parameters, and take out the ones handled by the pool
+    if (
+      typeof options === 'undefined' &&
+      typeof parameters === 'object' && parameters !== null &&
+      !Array.isArray(parameters) && isQueryOptions(parameters)
+    ) {
+      options = parameters;
+      parameters = null;
+    }
+    let cacheOptions;
+    if (options && typeof options === 'object' && typeof options.cache !== 'undefined') {
+      ({ cache: cacheOptions, ...options } = options);
+    }
+    // statements are only run again after a failure if the caller says they
+    // are safe to: even a SELECT can write (e.g. FROM FINAL TABLE (INSERT ...)),
+    // and the first execution may have been committed before the connection
+    // failed
+    let idempotent = false;
+    if (options && typeof options === 'object' && typeof options.idempotent !== 'undefined') {
+      ({ idempotent, ...options } = options);
+    }
+    // only used to choose an endpoint when the Pool is one of several
+    if (options && typeof options === 'object' && typeof options.readOnly !== 'undefined') {
+      const { readOnly, ...otherOptions } = options;
+      options = otherOptions;
+    }
+    // which waiting work gets the next free connection
+    let acquireOptions;
+    if (options && typeof options === 'object' && (typeof options.priority !== 'undefined' || typeof options.tenant !== 'undefined')) {
+      const { priority, tenant, ...otherOptions } = options;
+      acquireOptions = { priority, tenant };
+      options = otherOptions;
+    }
 
-          connection.query(sql, parameters, options, (error, result) => {
-            if (error) {
-              reject(error);
-            } else {
-              resolve(result);
-            }
-            connection.close();
-          });
+    // queries that return cursors can't be cached or shared between callers
+    if (this.cache && cacheOptions && !isCursorQuery(options)) {
+      const key = queryKey(sql, parameters, options);
+      if (typeof key !== 'undefined') {
+        const cached = this.cache.get(key);
+        if (typeof cached !== 'undefined') {
+          return settle(Promise.resolve(cached), callback);
+        }
+        const generation = this.cache.generation;
+        const execution = this.execute(sql, parameters, options, idempotent, acquireOptions).then((result) => {
+          this.cache.set(key, result, cacheOptions === true ? {} : cacheOptions, generation);
+          return result;
         });
-      });
+        return settle(execution, callback);
+      }
+    }
+
+    if (typeof callback !== 'function' || this.coalesce || this.limiter || this.retryPolicy) {
+      return settle(this.execute(sql, parameters, options, idempotent, acquireOptions), callback);
     }
 
     // ...or callback
-    this.connect((error, connection) => {
+    this.connect(acquireOptions, (error, connection) => {
       if (error) {
-        throw error;
+        process.nextTick(() => {
+          callback(error, undefined);
+        });
+        return undefined;
       }
 
+      const start = performance.now();
       return connection.query(sql, parameters, options, (error, result) => {
+        this.queryDuration.record(performance.now() - start);
         // after running, close the connection whether error or not
         process.nextTick(() => {
           callback(error, result);
         });
-        connection.close();
+        this.finishQuery(connection, error);
+      });
+    });
+  }
+
+  // runs a query, or attaches it to an identical query that is already
+  // running if coalescing is turned on, returning a Promise
+  execute(sql, parameters, options, idempotent = false, acquireOptions = undefined) {
+    if (this.coalesce && !isCursorQuery(options)) {
+      const key = this.coalesceKey(sql, parameters, options);
+      if (typeof key !== 'undefined') {
+        this.coalescableQueryCount++;
+        let execution = this.inFlightQueries.get(key);
+        if (typeof execution === 'undefined') {
+          execution = this.runQuery(sql, parameters, options, idempotent, acquireOptions);
+          this.inFlightQueries.set(key, execution);
+          const forget = () => {
+            this.inFlightQueries.delete(key);
+          };
+          execution.then(forget, forget);
+        } else {
+          this.coalescedQueryCount++;
+          // each caller gets its own result array, with the same properties,
+          // so that one of them changing it doesn't change it for the others
+          return execution.then((result) => defineResultMetadata([...result], resultMetadata(result)));
+        }
+        return execution;
+      }
+    }
+    return this.runQuery(sql, parameters, options, idempotent, acquireOptions);
+  }
+
+  // runs a query, and runs it again on another connection after the failures
+  // that the retry policy allows, returning a Promise
+  runQuery(sql, parameters, options, idempotent = false, acquireOptions = undefined, attempt = 1) {
+    return this.runLimitedQuery(sql, parameters, options, acquireOptions).catch((error) => {
+      if (
+        !this.retryPolicy ||
+        !idempotent ||
+        // streams were used up by the attempt that failed
+        !hasComparableParameters(parameters) ||
+        !this.isOpen ||
+        attempt >= this.retryPolicy.maxAttempts ||
+        !this.retryPolicy.isRetryable(error)
+      ) {
+        throw error;
+      }
+      this.retryCount++;
+      return new Promise((resolve) => {
+        setTimeout(resolve, this.retryPolicy.delay(attempt));
+      }).then(() => this.runQuery(sql, parameters, options, idempotent, acquireOptions, attempt + 1));
+    });
+  }
+
+  // runs a query on a connection from the pool, within the concurrency limit
+  // if there is one
+  runLimitedQuery(sql, parameters, options, acquireOptions) {
+    if (!this.limiter) {
+      return this.runQueryOnConnection(sql, parameters, options, acquireOptions);
+    }
+    return this.limiter.acquire().then((release) => {
+      const start = performance.now();
+      return this.runQueryOnConnection(sql, parameters, options, acquireOptions).then((result) => {
+        release(performance.now() - start);
+        return result;
+      }, (error) => {
+        release(performance.now() - start, true);
+        throw error;
       });
     });
   }
 
+  runQueryOnConnection(sql, parameters, options, acquireOptions) {
+    return new Promise((resolve, reject) => {
+      this.connect(acquireOptions, (error, connection) => {
+        if (error) {
+          reject(error);
+          return;
+        }
+
+        const start = performance.now();
+        connection.query(sql, parameters, options, (error, result) => {
+          this.queryDuration.record(performance.now() - start);
+          if (error) {
+            reject(error);
+          } else {
+            resolve(result);
+          }
+          this.finishQuery(connection, error);
+        });
+      });
+    });
+  }
+
+  // gives back the connection a query ran on, unless the query failed because
+  // the connection is broken
+  finishQuery(connection, error) {
+    if (error && isConnectionError(error)) {
+      this.retireConnection(connection);
+    } else {
+      connection.close();
+    }
+  }
+
+  /**
+   * Returns the current state of the pool, and statistics collected since it was created.
+   * @returns {object} - Connection counts (size, inUse, idle, connecting), the number of waiting
+   * requests for a connection, failure counters, histograms (in milliseconds) of the time spent
+   * waiting for a connection and running queries, and the coalescing statistics.
+   */
+  stats() {
+    return {
+      size: this.poolSize,
+      inUse: this.poolSize - this.freeConnections.length,
+      idle: this.freeConnections.length,
+      connecting: this.connectionsBeingCreatedCount,
+      waiting: this.waitingConnectionWork.length,
+      connectFailures: this.connectFailureCount,
+      acquireTimeouts: this.acquireTimeoutCount,
+      acquireRejections: this.acquireRejectedCount,
+      acquireWait: this.acquireWait.snapshot(),
+      queryDuration: this.queryDuration.snapshot(),
+      coalescing: this.coalescingStats(),
+      concurrencyLimit: this.limiter ? this.limiter.stats() : null,
+      retries: this.retryCount,
+    };
+  }
+
+  // Publishes stats() to the odbc:pool:stats diagnostics channel every
+  // statsIntervalMs, only computing them if someone is subscribed
+  scheduleStatsSnapshot() {
+    if (this.statsIntervalMs > 0 && this.isOpen) {
+      this.timerWheel.schedule(() => {
+        if (statsChannel.hasSubscribers) {
+          statsChannel.publish({ pool: this, stats: this.stats() });
+        }
+        this.scheduleStatsSnapshot();
+      }, this.statsIntervalMs);
+    }
+  }
+
+  /**
+   * Returns how many of the queries run with coalescing turned on were attached to an identical
+   * query that was already running, instead of being sent to the database.
+   * @returns {object} - queries: the queries that could be coalesced, coalesced: the queries
+   * attached to another execution, ratio: coalesced / queries.
+   */
+  coalescingStats() {
+    return {
+      queries: this.coalescableQueryCount,
+      coalesced: this.coalescedQueryCount,
+      ratio: this.coalescableQueryCount === 0 ? 0 : this.coalescedQueryCount / this.coalescableQueryCount,
+    };
+  }
+
+  /**
+   * Removes the results of the queries cached with a tag from the query cache of the pool.
+   * @param {string} tag - The tag passed in the cache option of the queries.
+   */
+  invalidate(tag) {
+    if (this.cache) {
+      this.cache.invalidate(tag);
+    }
+  }
+
+  /**
+   * Creates a loader that batches the keys passed to its load() function during one tick of the
+   * event loop into IN-list queries run on connections from the pool.
+   * @param {string} sqlTemplate - SQL with one ? parameter marker, expanded to the list of keys.
+   * @param {object} options - key: the column (or a function of a row) holding the key of a row,
+   * maxBatch: the most keys queried by one IN list.
+   * @returns {BatchLoader}
+   */
+  batchLoader(sqlTemplate, options) {
+    return new BatchLoader(this, sqlTemplate, options);
+  }
+
   // close the pool and all of the connections
   async close(callback = undefined) {
     const connections = [...this.freeConnections];
     this.freeConnections.length = 0;
     this.isOpen = false;
+    this.timerWheel.stop();
 
     if (typeof callback === 'undefined') {
       return new Promise((resolve, reject) => {
@@ -347,7 +905,7 @@ class Pool {
       });
     }
 
-    async.each(this.freeConnections, (connection, cb) => {
+    async.each(connections, (connection, cb) => {
       connection.nativeClose((error) => {
         this.poolSize--;
         cb(error);
@@ -355,30 +913,208 @@ class Pool {
     }, error => callback(error));
   }
 
+  // Returns a connection closed by its user to the pool, after undoing any
+  // transaction or isolation level it was left with. Connections whose state
+  // can't be reset are closed instead of being handed to the next user.
+  releaseConnection(connection) {
+    this.checkIn(connection);
+    if (!this.resetOnRelease) {
+      this.connectionEmitter.emit('connected', connection);
+      return;
+    }
+    connection.resetState((error) => {
+      if (error) {
+        this.retireConnection(connection);
+        return;
+      }
+      this.connectionEmitter.emit('connected', connection);
+    });
+  }
+
+  isTenantEligible(tenant) {
+    if (tenant === undefined) {
+      return true;
+    }
+    const limit = this.tenantLimits[tenant] !== undefined ? this.tenantLimits[tenant] : this.tenantLimit;
+    return (this.tenantConnectionCounts.get(tenant) || 0) < limit;
+  }
+
+  // Counts a connection handed out against the limit of its tenant
+  checkOut(connection, tenant) {
+    if (tenant !== undefined) {
+      connection.tenant = tenant;
+      this.tenantConnectionCounts.set(tenant, (this.tenantConnectionCounts.get(tenant) || 0) + 1);
+    }
+  }
+
+  // Gives back a connection counted against the limit of its tenant, and
+  // hands free connections to the work of the tenant that was waiting for
+  // its limit
+  checkIn(connection) {
+    const { tenant } = connection;
+    if (tenant === undefined) {
+      return;
+    }
+    connection.tenant = undefined;
+    const count = this.tenantConnectionCounts.get(tenant) - 1;
+    if (count === 0) {
+      this.tenantConnectionCounts.delete(tenant);
+    } else {
+      this.tenantConnectionCounts.set(tenant, count);
+    }
+    while (this.freeConnections.length > 0 && this.waitingConnectionWork.length > 0) {
+      const connectionWork = this.waitingConnectionWork.shift();
+      if (typeof connectionWork === 'undefined') {
+        break;
+      }
+      const freeConnection = this.freeConnections.pop();
+      this.cancelIdleTimers(freeConnection);
+      connectionWork.settle(null, freeConnection);
+    }
+  }
+
+  // Adds a connection to the free connections, at the end that connect()
+  // takes connections from unless it has been free the longest
+  addFreeConnection(connection, leastRecentlyUsed = false) {
+    connection.idleSince = Date.now();
+    if (leastRecentlyUsed) {
+      this.freeConnections.unshift(connection);
+    } else {
+      this.freeConnections.push(connection);
+    }
+    this.scheduleIdleTimeout(connection);
+    this.scheduleKeepalive(connection);
+  }
+
+  // Closes the connection once it has been free for idleTimeoutMs, if the pool
+  // shrinks
+  scheduleIdleTimeout(connection) {
+    if (this.shrink && this.idleTimeoutMs > 0 && this.isOpen) {
+      const idleMs = Date.now() - connection.idleSince;
+      connection.idleTimer = this.timerWheel.schedule(() => {
+        connection.idleTimer = undefined;
+        // only close connections above the minimum size of the pool
+        if (this.poolSize > this.minSize && this.removeFreeConnection(connection)) {
+          this.retireConnection(connection);
+        }
+      }, Math.max(this.idleTimeoutMs - idleMs, 0));
+    }
+  }
+
+  // Runs validationQuery on the connection every keepaliveMs while it is free,
+  // so that the network and the database don't drop it for being idle, and
+  // so that it is replaced if they have
+  scheduleKeepalive(connection) {
+    if (this.keepaliveMs > 0 && this.validationQuery && this.isOpen) {
+      connection.keepaliveTimer = this.timerWheel.schedule(async () => {
+        connection.keepaliveTimer = undefined;
+        // take the connection out of the pool while it is pinged, so it isn't
+        // handed out at the same time
+        if (!this.removeFreeConnection(connection)) {
+          return;
+        }
+        if (!(await this.ping(connection)) || !this.isOpen || connection.expired) {
+          this.retireConnection(connection);
+          return;
+        }
+        const connectionWork = this.waitingConnectionWork.shift();
+        if (typeof connectionWork !== 'undefined') {
+          this.cancelIdleTimers(connection);
+          connectionWork.settle(null, connection);
+          return;
+        }
+        // it goes back where it was, and it is still as idle as before
+        this.freeConnections.unshift(connection);
+        if (!connection.idleTimer) {
+          this.scheduleIdleTimeout(connection);
+        }
+        this.scheduleKeepalive(connection);
+      }, this.keepaliveMs);
+    }
+  }
+
+  cancelIdleTimers(connection) {
+    if (connection.idleTimer) {
+      this.timerWheel.cancel(connection.idleTimer);
+      connection.idleTimer = undefined;
+    }
+    if (connection.keepaliveTimer) {
+      this.timerWheel.cancel(connection.keepaliveTimer);
+      connection.keepaliveTimer = undefined;
+    }
+  }
+
+  // Resolves whether validationQuery ran successfully on the connection
+  async ping(connection) {
+    try {
+      await connection.query(this.validationQuery);
+      return true;
+    } catch (error) {
+      return false;
+    }
+  }
+
+  // Closes the connection once it has been open for about maxLifetimeMs: right
+  // away if it is free, or else once it is returned to the pool
+  scheduleMaxLifetime(connection) {
+    if (this.maxLifetimeMs > 0) {
+      const lifetime = this.maxLifetimeMs * (1 - Math.random() * MAX_LIFETIME_JITTER);
+      connection.lifetimeTimer = this.timerWheel.schedule(() => {
+        connection.lifetimeTimer = undefined;
+        connection.expired = true;
+        if (this.removeFreeConnection(connection)) {
+          this.retireConnection(connection);
+        }
+      }, lifetime);
+    }
+  }
+
+  removeFreeConnection(connection) {
+    const index = this.freeConnections.indexOf(connection);
+    if (index === -1) {
+      return false;
+    }
+    this.freeConnections.splice(index, 1);
+    return true;
+  }
+
+  // Closes a connection taken out of the pool, opening a new one in its place
+  // if the pool would be left with fewer than minSize connections, or if work
+  // is waiting for a connection
+  retireConnection(connection) {
+    this.checkIn(connection);
+    this.cancelIdleTimers(connection);
+    if (connection.lifetimeTimer) {
+      this.timerWheel.cancel(connection.lifetimeTimer);
+      connection.lifetimeTimer = undefined;
+    }
+    this.poolSize--;
+    connection.nativeClose(() => {
+      // nothing is waiting on the close, so errors closing are ignored
+    });
+    if (
+      this.isOpen &&
+      (
+        this.poolSize + this.connectionsBeingCreatedCount < this.minSize ||
+        this.connectionsBeingCreatedCount < this.waitingConnectionWork.length
+      )
+    ) {
+      this.increasePoolSize(1);
+    }
+  }
+
   async init(callback = undefined) {
     if (!this.isOpen) {
       this.isOpen = true;
+      this.scheduleStatsSnapshot();
       // promise...
       if (typeof callback === 'undefined') {
-        return new Promise(async (resolve, reject) => {
-          try {
-            await this.increasePoolSize(this.initialSize);
-            // Try to get one connection during init to make sure there were
-            // no errors with the connection string
-            const connection = await this.connect();
-            this.freeConnections.unshift(connection);
-            resolve();
-          } catch (error) {
-            reject(error);
-          }
-        });
+        return this.warmUp();
       }
 
       // ...or callback
       try {
-        await this.increasePoolSize(this.initialSize);
-        let connection = await this.connect();
-        connection.close();
+        await this.warmUp();
       } catch (error) {
         return callback(error);
       }
@@ -387,6 +1123,49 @@ class Pool {
     return undefined;
   }
 
+  // Opens the initial connections of the pool, several at a time, resolving
+  // once minReadySize of them are open, so that errors with the connection
+  // string are caught
+  async warmUp() {
+    const readySize = Math.min(this.minReadySize, this.initialSize);
+    this.increasePoolSize(this.initialSize, Math.max(this.warmupConcurrency, this.maxActivelyConnecting));
+    if (readySize > 0) {
+      return this.waitForConnections(readySize);
+    }
+    // Try to get one connection to make sure there were no errors with the
+    // connection string
+    const connection = await this.connect();
+    this.addFreeConnection(connection, true);
+    return undefined;
+  }
+
+  // Resolves once the pool has count open connections. Connections that fail
+  // to open only matter once too many have failed for the rest to make up
+  // count, and then it rejects with the error of the last one that failed.
+  waitForConnections(count) {
+    return new Promise((resolve, reject) => {
+      const onConnected = () => {
+        if (this.poolSize >= count) {
+          removeListeners();
+          resolve();
+        }
+      };
+      const onConnectionError = (error) => {
+        if (this.poolSize + this.connectionsBeingCreatedCount < count) {
+          removeListeners();
+          reject(error);
+        }
+      };
+      const removeListeners = () => {
+        this.connectionEmitter.removeListener('connected', onConnected);
+        this.connectionEmitter.removeListener('connectionError', onConnectionError);
+      };
+      this.connectionEmitter.on('connected', onConnected);
+      this.connectionEmitter.on('connectionError', onConnectionError);
+      onConnected();
+    });
+  }
+
   generateConnectPromise = function(connectionConfig) {
     return new Promise((resolve, reject) => {
       odbc.connect(connectionConfig, (error, nativeConnection) => {
@@ -405,6 +1184,8 @@ class Pool {
           // send it to the user work that was waiting (either as an error
           // parameter in the user's callback, or as a thrown error that the
           // user has to catch.)
+          this.pool.connectionsBeingCreatedCount--;
+          this.pool.connectFailureCount++;
           this.pool.connectionEmitter.emit('connectionError', error);
 
           // This reject is swallowed in the ConnectionQueue's dequeue function
@@ -418,10 +1199,11 @@ class Pool {
         this.pool.poolSize++;
         let connection = new Connection(nativeConnection);
         connection.nativeClose = connection.close;
+        this.pool.scheduleMaxLifetime(connection);
 
         if (this.pool.reuseConnections) {
           connection.close = async (closeCallback = undefined) => {
-            this.pool.connectionEmitter.emit('connected', connection);
+            this.pool.releaseConnection(connection);
 
             if (typeof closeCallback === 'undefined') {
               return new Promise((resolve, reject) => {
@@ -433,6 +1215,11 @@ class Pool {
           };
         } else {
           connection.close = async (closeCallback = undefined) => {
+            if (connection.lifetimeTimer) {
+              this.pool.timerWheel.cancel(connection.lifetimeTimer);
+              connection.lifetimeTimer = undefined;
+            }
+            this.pool.checkIn(connection);
             this.pool.increasePoolSize(1);
             if (typeof closeCallback === 'undefined') {
               return new Promise((resolve, reject) => {
@@ -458,11 +1245,11 @@ class Pool {
   }
 
   // odbc.connect runs on an AsyncWorker, so this is truly non-blocking
-  async increasePoolSize(count) {
+  async increasePoolSize(count, maxActivelyConnecting = this.maxActivelyConnecting) {
     this.connectionsBeingCreatedCount += count;
     for (let i = 0; i < count; i++)
     {
-      ConnectionQueue.enqueue(this, this.generateConnectPromise, this.connectionConfig);
+      this.connectionQueue.enqueue(this.generateConnectPromise, this.connectionConfig, maxActivelyConnecting);
     }
   }
 }
@@ -0,0 +1,393 @@
+const { performance } = require('perf_hooks');
+const { Pool } = require('./Pool');
+const { isQueryOptions } = require('./Connection');
+const { BatchLoader } = require('./BatchLoader');
+const { isConnectionError } = require('./RetryPolicy');
+
+const ROLE_DEFAULT = 'primary';
+const WEIGHT_DEFAULT = 1;
+const BALANCE_DEFAULT = 'inFlight';
+const EJECT_AFTER_FAILURES_DEFAULT = 3;
+const REPROBE_INTERVAL_DEFAULT = 5000;
+const REPROBE_TIMEOUT_DEFAULT = 5000;
+// the weight of each new sample in the average latency of an endpoint
+const LATENCY_SMOOTHING = 0.2;
+
+// Takes the readOnly option out of the query options, which can be passed in
+// place of the parameters or of the options
+function takeReadOnly(args) {
+  let readOnly = false;
+  const forwarded = args.map((arg) => {
+    if (
+      typeof arg === 'object' && arg !== null && !Array.isArray(arg) &&
+      typeof arg.readOnly !== 'undefined' && isQueryOptions(arg)
+    ) {
+      const { readOnly: value, ...options } = arg;
+      readOnly = value;
+      return options;
+    }
+    return arg;
+  });
+  return { readOnly: readOnly === true, forwarded };
+}
+
+// A set of Pools, one for each of several endpoints (a primary database and
+// its read replicas, for example) that are used as if they were a single Pool.
+// Work marked readOnly goes to the least loaded healthy replica, and all other
+// work to the least loaded healthy primary. An endpoint is ejected after
+// ejectAfterFailures connection errors in a row, and gets no work until a
+// connection to it (tried every reprobeIntervalMs) works again.
+class PoolCluster {
+
+  constructor(config) {
+    const {
+      endpoints,
+      balance = BALANCE_DEFAULT,
+      ejectAfterFailures = EJECT_AFTER_FAILURES_DEFAULT,
+      reprobeIntervalMs = REPROBE_INTERVAL_DEFAULT,
+      reprobeTimeoutMs = REPROBE_TIMEOUT_DEFAULT,
+      ...poolConfig
+    } = config;
+
+    if (!Array.isArray(endpoints) || endpoints.length === 0) {
+      throw new TypeError('Pool configuration "endpoints" must be an array of at least one endpoint');
+    }
+    if (balance !== 'inFlight' && balance !== 'latency') {
+      throw new TypeError('Pool configuration "balance" must be "inFlight" or "latency"');
+    }
+
+    this.balance = balance;
+    this.ejectAfterFailures = ejectAfterFailures;
+    this.reprobeIntervalMs = reprobeIntervalMs;
+    this.reprobeTimeoutMs = reprobeTimeoutMs;
+    this.isOpen = false;
+
+    this.endpoints = endpoints.map((endpoint, index) => {
+      const {
+        name = String(index),
+        role = ROLE_DEFAULT,
+        weight = WEIGHT_DEFAULT,
+        ...endpointConfig
+      } = typeof endpoint === 'string' ? { connectionString: endpoint } : endpoint;
+      if (role !== 'primary' && role !== 'replica') {
+        throw new TypeError(`Pool endpoint "${name}" must have the role "primary" or "replica"`);
+      }
+      if (typeof weight !== 'number' || weight <= 0) {
+        throw new TypeError(`Pool endpoint "${name}" must have a weight greater than 0`);
+      }
+      return {
+        name,
+        role,
+        weight,
+        // connections to replicas are opened in read-only access mode
+        pool: new Pool({ readOnly: role === 'replica', ...poolConfig, ...endpointConfig }),
+        inFlight: 0,
+        // average latency (in milliseconds) of the queries that succeeded
+        latency: 0,
+        failures: 0,
+        healthy: true,
+        reprobeTimer: null,
+      };
+    });
+    if (!this.endpoints.some((endpoint) => endpoint.role === 'primary')) {
+      throw new TypeError('Pool configuration "endpoints" must have at least one endpoint with the role "primary"');
+    }
+
+    // where the search for the least loaded endpoint starts, so that endpoints
+    // with the same load take turns
+    this.nextIndex = 0;
+  }
+
+  // Opens the Pool of every endpoint. Endpoints that can't be reached are
+  // ejected; only failing to reach any endpoint at all is an error.
+  async init(callback = undefined) {
+    let error = null;
+    if (!this.isOpen) {
+      this.isOpen = true;
+      const results = await Promise.allSettled(this.endpoints.map((endpoint) => endpoint.pool.init()));
+      results.forEach((result, index) => {
+        if (result.status === 'rejected') {
+          this.eject(this.endpoints[index]);
+        }
+      });
+      if (results.every((result) => result.status === 'rejected')) {
+        error = results[0].reason;
+      }
+    }
+
+    if (typeof callback === 'undefined') {
+      if (error) {
+        throw error;
+      }
+      return undefined;
+    }
+    return callback(error);
+  }
+
+  // the healthy endpoint with the least load that work with the given access
+  // can go to. Reads fall back to the primaries when no replica is healthy,
+  // and if no endpoint is healthy, every endpoint is tried anyway rather than
+  // failing all of the work.
+  choose(readOnly) {
+    const primaries = this.endpoints.filter((endpoint) => endpoint.role === 'primary');
+    let candidates = [];
+    if (readOnly) {
+      candidates = this.endpoints.filter((endpoint) => endpoint.role === 'replica' && endpoint.healthy);
+    }
+    if (candidates.length === 0) {
+      candidates = primaries.filter((endpoint) => endpoint.healthy);
+    }
+    if (candidates.length === 0) {
+      candidates = readOnly ? this.endpoints : primaries;
+    }
+
+    const start = this.nextIndex % candidates.length;
+    this.nextIndex++;
+    let chosen;
+    let lowestLoad = Infinity;
+    for (let i = 0; i < candidates.length; i++) {
+      const endpoint = candidates[(start + i) % candidates.length];
+      const load = this.load(endpoint);
+      if (load < lowestLoad) {
+        chosen = endpoint;
+        lowestLoad = load;
+      }
+    }
+    return chosen;
+  }
+
+  load(endpoint) {
+    const pending = endpoint.inFlight + 1;
+    if (this.balance === 'latency') {
+      // an endpoint with no latency yet counts as a fast one, so it gets tried
+      return (pending * Math.max(endpoint.latency, 1)) / endpoint.weight;
+    }
+    return pending / endpoint.weight;
+  }
+
+  // records the outcome of work done on an endpoint
+  complete(endpoint, start, error) {
+    endpoint.inFlight--;
+    if (error) {
+      if (isConnectionError(error)) {
+        endpoint.failures++;
+        if (endpoint.healthy && endpoint.failures >= this.ejectAfterFailures) {
+          this.eject(endpoint);
+        }
+      }
+      return;
+    }
+    endpoint.failures = 0;
+    const latency = performance.now() - start;
+    endpoint.latency = endpoint.latency === 0
+      ? latency
+      : endpoint.latency + (latency - endpoint.latency) * LATENCY_SMOOTHING;
+  }
+
+  eject(endpoint) {
+    endpoint.healthy = false;
+    this.scheduleReprobe(endpoint);
+  }
+
+  // tries to get a working connection from an ejected endpoint every
+  // reprobeIntervalMs, putting the endpoint back into use once it does
+  scheduleReprobe(endpoint) {
+    if (!this.isOpen || endpoint.reprobeTimer !== null) {
+      return;
+    }
+    endpoint.reprobeTimer = setTimeout(async () => {
+      endpoint.reprobeTimer = null;
+      let connection;
+      try {
+        connection = await endpoint.pool.connect({ acquireTimeoutMs: this.reprobeTimeoutMs });
+      } catch (error) {
+        this.scheduleReprobe(endpoint);
+        return;
+      }
+      const connected = connection.connected;
+      if (connected) {
+        await connection.close();
+        endpoint.healthy = true;
+        endpoint.failures = 0;
+        // its latency from before it failed doesn't say much any more
+        endpoint.latency = 0;
+      } else {
+        endpoint.pool.retireConnection(connection);
+        this.scheduleReprobe(endpoint);
+      }
+    }, this.reprobeIntervalMs);
+    // don't keep the process alive just to reprobe endpoints
+    endpoint.reprobeTimer.unref();
+  }
+
+  /**
+   * Gets a connection from the least loaded endpoint for the access requested.
+   * @param {object} [options] - readOnly: whether the connection is only used to read, so that it
+   * can come from a replica, along with the options of Pool.connect.
+   * @param {function} [callback] - Callback function. If not provided, a Promise is returned.
+   */
+  async connect(opts = undefined, cb = undefined) {
+    let options = opts;
+    let callback = cb;
+    if (typeof options === 'function' && typeof callback === 'undefined') {
+      callback = options;
+      options = undefined;
+    }
+    if (
+      (typeof options !== 'undefined' && (typeof options !== 'object' || options === null)) ||
+      (typeof callback !== 'undefined' && typeof callback !== 'function')
+    ) {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to pool.connect({object}[optional], {function}[optional]).');
+    }
+
+    const { readOnly = false, ...connectOptions } = options || {};
+    const endpoint = this.choose(readOnly === true);
+    const start = performance.now();
+    endpoint.inFlight++;
+
+    let connection;
+    try {
+      connection = await endpoint.pool.connect(connectOptions);
+    } catch (error) {
+      this.complete(endpoint, start, error);
+      if (typeof callback === 'undefined') {
+        throw error;
+      }
+      return callback(error, undefined);
+    }
+
+    // the connection counts as load on the endpoint until it is given back
+    const { close } = connection;
+    connection.close = (closeCallback = undefined) => {
+      connection.close = close;
+      endpoint.inFlight--;
+      return close(closeCallback);
+    };
+
+    if (typeof callback === 'undefined') {
+      return connection;
+    }
+    return callback(null, connection);
+  }
+
+  /**
+   * Runs a query on the least loaded endpoint for it: a replica if the readOnly query option is
+   * true, otherwise a primary. Takes the same arguments as Pool.query.
+   */
+  query(sql, ...args) {
+    const { readOnly, forwarded } = takeReadOnly(args);
+    const endpoint = this.choose(readOnly);
+    const start = performance.now();
+    endpoint.inFlight++;
+
+    const callbackIndex = forwarded.findIndex((arg) => typeof arg === 'function');
+    if (callbackIndex === -1) {
+      return endpoint.pool.query(sql, ...forwarded).then((result) => {
+        this.complete(endpoint, start, null);
+        return result;
+      }, (error) => {
+        this.complete(endpoint, start, error);
+        throw error;
+      });
+    }
+
+    const callback = forwarded[callbackIndex];
+    forwarded[callbackIndex] = (error, result) => {
+      this.complete(endpoint, start, error);
+      callback(error, result);
+    };
+    return endpoint.pool.query(sql, ...forwarded);
+  }
+
+  /**
+   * Returns the state of every endpoint.
+   * @returns {object} - endpoints: the name, role, weight, health, in-flight work, average latency,
+   * and Pool.stats() of each endpoint.
+   */
+  stats() {
+    return {
+      endpoints: this.endpoints.map((endpoint) => ({
+        name: endpoint.name,
+        role: endpoint.role,
+        weight: endpoint.weight,
+        healthy: endpoint.healthy,
+        inFlight: endpoint.inFlight,
+        latency: endpoint.latency,
+        pool: endpoint.pool.stats(),
+      })),
+    };
+  }
+
+  /**
+   * Returns how well queries are being coalesced, added up over the Pools of all of the endpoints.
+   * @returns {object} - queries: the queries that could be coalesced, coalesced: the queries
+   * attached to another execution, ratio: coalesced / queries.
+   */
+  coalescingStats() {
+    let queries = 0;
+    let coalesced = 0;
+    this.endpoints.forEach((endpoint) => {
+      const stats = endpoint.pool.coalescingStats();
+      queries += stats.queries;
+      coalesced += stats.coalesced;
+    });
+    return {
+      queries,
+      coalesced,
+      ratio: queries === 0 ? 0 : coalesced / queries,
+    };
+  }
+
+  /**
+   * Removes the results of the queries cached with a tag from the query cache of every endpoint.
+   * @param {string} tag - The tag passed in the cache option of the queries.
+   */
+  invalidate(tag) {
+    this.endpoints.forEach((endpoint) => {
+      endpoint.pool.invalidate(tag);
+    });
+  }
+
+  /**
+   * Creates a loader that batches the keys passed to its load() function during one tick of the
+   * event loop into IN-list queries, which are run on replicas like other readOnly queries.
+   * @param {string} sqlTemplate - SQL with one ? parameter marker, expanded to the list of keys.
+   * @param {object} options - The options of Pool.batchLoader, and readOnly: false to run the
+   * queries on a primary.
+   * @returns {BatchLoader}
+   */
+  batchLoader(sqlTemplate, options) {
+    const { readOnly = true, ...loaderOptions } = options || {};
+    const queryRunner = {
+      query: (sql, parameters) => this.query(sql, parameters, { readOnly }),
+    };
+    return new BatchLoader(queryRunner, sqlTemplate, loaderOptions);
+  }
+
+  async close(callback = undefined) {
+    this.isOpen = false;
+    this.endpoints.forEach((endpoint) => {
+      if (endpoint.reprobeTimer !== null) {
+        clearTimeout(endpoint.reprobeTimer);
+        endpoint.reprobeTimer = null;
+      }
+    });
+
+    let error = null;
+    try {
+      await Promise.all(this.endpoints.map((endpoint) => endpoint.pool.close()));
+    } catch (closeError) {
+      error = closeError;
+    }
+
+    if (typeof callback === 'undefined') {
+      if (error) {
+        throw error;
+      }
+      return undefined;
+    }
+    return callback(error);
+  }
+}
+
+module.exports.PoolCluster = PoolCluster;
@@ -0,0 +1,154 @@
+const v8 = require('v8');
+
+const MAX_BYTES_DEFAULT = 67108864; // 64 MiB
+const TTL_DEFAULT = 60000;
+
+// The properties that results carry besides their rows. They aren't
+// enumerable (and 'columns' starts out as an accessor), so v8.serialize would
+// leave them out of a result serialized as it is.
+const RESULT_METADATA = ['statement', 'parameters', 'return', 'count', 'columns'];
+
+// the metadata of a result, as a plain object
+function resultMetadata(result) {
+  const metadata = {};
+  RESULT_METADATA.forEach((name) => {
+    metadata[name] = result[name];
+  });
+  return metadata;
+}
+
+// Defines the metadata on an array of rows the way it is defined on results
+// returned by the driver: not enumerable, but writable and configurable
+function defineResultMetadata(rows, metadata) {
+  const descriptors = {};
+  RESULT_METADATA.forEach((name) => {
+    descriptors[name] = {
+      value: metadata[name],
+      writable: true,
+      configurable: true,
+      enumerable: false,
+    };
+  });
+  return Object.defineProperties(rows, descriptors);
+}
+
+// A cache of query results, bounded by the total size of its entries and
+// evicting the least recently used entry first. Results are stored serialized
+// in a Buffer instead of as the rows themselves, so that a cache holding many
+// results doesn't keep millions of JavaScript objects alive for the garbage
+// collector to trace, and each hit is deserialized into a new copy of the
+// result that the caller is free to modify.
+class QueryCache {
+
+  constructor(options = {}) {
+    const maxBytes = options.maxBytes !== undefined ? options.maxBytes : MAX_BYTES_DEFAULT;
+    const ttl = options.ttl !== undefined ? options.ttl : TTL_DEFAULT;
+    if (!Number.isInteger(maxBytes) || maxBytes <= 0) {
+      throw new TypeError('Pool configuration "cache.maxBytes" must be an integer greater than 0');
+    }
+    if (typeof ttl !== 'number' || ttl <= 0) {
+      throw new TypeError('Pool configuration "cache.ttl" must be a number greater than 0');
+    }
+
+    this.maxBytes = maxBytes;
+    this.ttl = ttl;
+    this.bytes = 0;
+
+    // key => { data, bytes, expires, tags }, from least to most recently used
+    this.entries = new Map();
+    // tag => Set of the keys of the entries with that tag
+    this.keysByTag = new Map();
+
+    // incremented by every invalidation, so that a query that was running
+    // while its entries were invalidated doesn't store its (stale) result
+    this.generation = 0;
+  }
+
+  get(key) {
+    const entry = this.entries.get(key);
+    if (entry === undefined) {
+      return undefined;
+    }
+    if (entry.expires <= Date.now()) {
+      this.delete(key);
+      return undefined;
+    }
+    // move the entry to the most recently used end
+    this.entries.delete(key);
+    this.entries.set(key, entry);
+    const { rows, metadata } = v8.deserialize(entry.data);
+    return defineResultMetadata(rows, metadata);
+  }
+
+  set(key, result, options, generation) {
+    if (generation !== this.generation) {
+      return;
+    }
+
+    const data = v8.serialize({ rows: [...result], metadata: resultMetadata(result) });
+    if (data.length > this.maxBytes) {
+      return;
+    }
+
+    const ttl = options.ttl !== undefined ? options.ttl : this.ttl;
+    const tags = options.tags || [];
+
+    this.delete(key);
+    this.entries.set(key, {
+      data,
+      bytes: data.length,
+      expires: Date.now() + ttl,
+      tags,
+    });
+    this.bytes += data.length;
+    tags.forEach((tag) => {
+      let keys = this.keysByTag.get(tag);
+      if (keys === undefined) {
+        keys = new Set();
+        this.keysByTag.set(tag, keys);
+      }
+      keys.add(key);
+    });
+
+    // evict the least recently used entries
+    while (this.bytes > this.maxBytes) {
+      this.delete(this.entries.keys().next().value);
+    }
+  }
+
+  delete(key) {
+    const entry = this.entries.get(key);
+    if (entry === undefined) {
+      return;
+    }
+    this.entries.delete(key);
+    this.bytes -= entry.bytes;
+    entry.tags.forEach((tag) => {
+      const keys = this.keysByTag.get(tag);
+      keys.delete(key);
+      if (keys.size === 0) {
+        this.keysByTag.delete(tag);
+      }
+    });
+  }
+
+  invalidate(tag) {
+    this.generation++;
+    const keys = this.keysByTag.get(tag);
+    if (keys === undefined) {
+      return;
+    }
+    [...keys].forEach((key) => this.delete(key));
+  }
+
+  clear() {
+    this.generation++;
+    this.entries.clear();
+    this.keysByTag.clear();
+    this.bytes = 0;
+  }
+}
+
+module.exports.QueryCache = QueryCache;
+module.exports.resultMetadata = resultMetadata;
+module.exports.defineResultMetadata = defineResultMetadata;
@@ -0,0 +1,62 @@
+// communication link failure, connection does not exist, serialization
+// failure (which is also what most databases report for a deadlock victim),
+// and PostgreSQL's deadlock detected
+const STATES_DEFAULT = ['08S01', '08003', '40001', '40P01'];
+const MAX_ATTEMPTS_DEFAULT = 3;
+const BASE_DELAY_DEFAULT = 100;
+const MAX_DELAY_DEFAULT = 5000;
+
+// Decides which failed queries a Pool runs again, and how long it waits
+// before each attempt. A query is retried when one of the errors the driver
+// returned for it (the odbcErrors of the error) has a SQLSTATE in states, up to
+// maxAttempts attempts in all. The waits grow exponentially from baseDelayMs up
+// to maxDelayMs, and each is a random part of that ("full jitter"), so that
+// clients that failed together don't all come back at the same moment.
+class RetryPolicy {
+
+  constructor(options = {}) {
+    const states = options.states !== undefined ? options.states : STATES_DEFAULT;
+    const maxAttempts = options.maxAttempts !== undefined ? options.maxAttempts : MAX_ATTEMPTS_DEFAULT;
+    const baseDelayMs = options.baseDelayMs !== undefined ? options.baseDelayMs : BASE_DELAY_DEFAULT;
+    const maxDelayMs = options.maxDelayMs !== undefined ? options.maxDelayMs : MAX_DELAY_DEFAULT;
+    if (!Array.isArray(states) || !states.every((state) => typeof state === 'string')) {
+      throw new TypeError('Pool configuration "retry.states" must be an array of SQLSTATE strings');
+    }
+    if (!Number.isInteger(maxAttempts) || maxAttempts < 1) {
+      throw new TypeError('Pool configuration "retry.maxAttempts" must be an integer greater than 0');
+    }
+    if (typeof baseDelayMs !== 'number' || baseDelayMs < 0 || typeof maxDelayMs !== 'number' || maxDelayMs < baseDelayMs) {
+      throw new TypeError('Pool configuration "retry" must have 0 <= baseDelayMs <= maxDelayMs');
+    }
+
+    this.states = new Set(states);
+    this.maxAttempts = maxAttempts;
+    this.baseDelayMs = baseDelayMs;
+    this.maxDelayMs = maxDelayMs;
+  }
+
+  isRetryable(error) {
+    return error !== null
+      && typeof error === 'object'
+      && Array.isArray(error.odbcErrors)
+      && error.odbcErrors.some((odbcError) => this.states.has(odbcError.state));
+  }
+
+  // how long to wait before attempt number attempt + 1
+  delay(attempt) {
+    const ceiling = Math.min(this.maxDelayMs, this.baseDelayMs * (2 ** (attempt - 1)));
+    return Math.random() * ceiling;
+  }
+}
+
+// Whether an error means the connection it happened on can't be used any
+// more: the SQLSTATEs of class 08 are all connection exceptions.
+function isConnectionError(error) {
+  return error !== null
+    && typeof error === 'object'
+    && Array.isArray(error.odbcErrors)
+    && error.odbcErrors.some((odbcError) => typeof odbcError.state === 'string' && odbcError.state.startsWith('08'));
+}
+
+module.exports.RetryPolicy = RetryPolicy;
+module.exports.isConnectionError = isConnectionError;
@@ -1,4 +1,5 @@
 const { Cursor } = require('./Cursor');
+const { wrapStreamParameters } = require('./dataAtExecution');
 
 class Statement {
 
@@ -59,6 +60,8 @@ class Statement {
       throw new TypeError('[node-odbc]: Incorrect function signature for call to statement.bind({array}, {function}[optional]).');
     }
 
+    parameters = wrapStreamParameters(parameters);
+
     // promise...
     if (typeof callback === 'undefined') {
       if (!this.odbcStatement)
@@ -168,6 +171,70 @@ class Statement {
     }
   }
 
+  /**
+   * Binds parameters to the prepared SQL statement template and executes it, returning the
+   * result. Binding and executing happen in a single trip to the thread pool, so it is the
+   * cheapest way to execute a prepared statement repeatedly.
+   * @param {*[]} parameters - The parameters to bind to the previously prepared SQL statement.
+   * @param {object} [options] - The query options, as for execute().
+   * @param {function} [callback] - The callback function that returns the result. If omitted, uses a Promise.
+   * @returns {undefined|Promise}
+   */
+  run(parameters, options = undefined, callback = undefined) {
+
+    if (typeof options === 'function' && callback === undefined) {
+      callback = options;
+      options = null;
+    }
+
+    if (options === undefined)
+    {
+      options = null;
+    }
+
+    if (!Array.isArray(parameters)
+    || (typeof callback !== 'function' && typeof callback !== 'undefined')
+    || typeof options !== 'object') {
+      throw new TypeError('[node-odbc]: Incorrect function signature for call to statement.run({array}, {object}[optional], {function}[optional]).');
+    }
+
+    parameters = wrapStreamParameters(parameters);
+
+    const returnsCursor = options !== null
+      && (options.hasOwnProperty('fetchSize') || options.hasOwnProperty('cursor'));
+
+    // Promise...
+    if (typeof callback === 'undefined') {
+      if (!this.odbcStatement)
+      {
+        throw new Error(Statement.STATEMENT_CLOSED_ERROR);
+      }
+
+      return new Promise((resolve, reject) => {
+        this.odbcStatement.run(parameters, options, (error, result) => {
+          if (error) {
+            reject(error);
+          } else {
+            resolve(returnsCursor ? new Cursor(result) : result);
+          }
+        });
+      });
+    }
+
+    // ...or callback
+    if (!this.odbcStatement)
+    {
+      callback(new Error(Statement.STATEMENT_CLOSED_ERROR));
+    } else {
+      this.odbcStatement.run(parameters, options, (error, result) => {
+        if (error) {
+          return callback(error);
+        }
+        return callback(error, returnsCursor ? new Cursor(result) : result);
+      });
+    }
+  }
+
   /**
    * Closes the statement, deleting the prepared statement and freeing the handle, making further
    * calls on the object invalid.
@@ -0,0 +1,87 @@
+const SLOT_COUNT = 64;
+
+// A hashed timer wheel: timers are put in one of a fixed number of slots by
+// the tick they expire in, and a single interval visits one slot per tick,
+// firing the timers of that slot that have expired. Scheduling and cancelling
+// a timer are O(1), and however many connections a pool has, it only ever
+// has one timer of its own running in the event loop (and none while nothing
+// is scheduled). Timers fire up to one tick late.
+class TimerWheel {
+
+  constructor(tickMs) {
+    this.tickMs = tickMs;
+    this.slots = Array.from({ length: SLOT_COUNT }, () => new Set());
+    this.count = 0;
+    this.interval = null;
+    // the last tick whose slot was visited
+    this.currentTick = Math.floor(Date.now() / tickMs);
+  }
+
+  schedule(callback, delay) {
+    if (this.interval === null) {
+      this.currentTick = Math.floor(Date.now() / this.tickMs);
+      this.interval = setInterval(() => this.tick(), this.tickMs);
+      // don't keep the process alive just to close idle connections
+      this.interval.unref();
+    }
+    const deadline = Date.now() + delay;
+    // the slot of the current tick has already been visited
+    const tick = Math.max(Math.ceil(deadline / this.tickMs), this.currentTick + 1);
+    const slot = this.slots[tick % SLOT_COUNT];
+    const timer = { callback, deadline, slot };
+    slot.add(timer);
+    this.count++;
+    return timer;
+  }
+
+  cancel(timer) {
+    if (timer.slot !== null && timer.slot.delete(timer)) {
+      timer.slot = null;
+      this.count--;
+      this.stopIfEmpty();
+    }
+  }
+
+  tick() {
+    const now = Date.now();
+    const nowTick = Math.floor(now / this.tickMs);
+    // visit every slot passed since the last tick, but each slot only once
+    // if the event loop was blocked for longer than a full turn of the wheel
+    const ticks = Math.min(nowTick - this.currentTick, SLOT_COUNT);
+    const expired = [];
+    for (let i = 1; i <= ticks; i++) {
+      const slot = this.slots[(this.currentTick + i) % SLOT_COUNT];
+      slot.forEach((timer) => {
+        if (timer.deadline <= now) {
+          slot.delete(timer);
+          timer.slot = null;
+          this.count--;
+          expired.push(timer);
+        }
+      });
+    }
+    this.currentTick = nowTick;
+    expired.forEach((timer) => timer.callback());
+    this.stopIfEmpty();
+  }
+
+  stopIfEmpty() {
+    if (this.count === 0 && this.interval !== null) {
+      clearInterval(this.interval);
+      this.interval = null;
+    }
+  }
+
+  stop() {
+    this.slots.forEach((slot) => {
+      slot.forEach((timer) => {
+        timer.slot = null;
+      });
+      slot.clear();
+    });
+    this.count = 0;
+    this.stopIfEmpty();
+  }
+}
+
+module.exports.TimerWheel = TimerWheel;
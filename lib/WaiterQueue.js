@@ -0,0 +1,72 @@
+const INITIAL_CAPACITY = 16;
+
+// A FIFO queue of the work waiting for a connection from a Pool, stored in a
+// ring buffer so that adding and removing waiters is O(1) no matter how many
+// are waiting. Waiters that time out or are aborted are only marked as
+// cancelled and skipped when they reach the front of the queue; the buffer is
+// compacted if cancelled waiters start to outnumber live ones.
+class WaiterQueue {
+
+  constructor() {
+    // capacity is always a power of two, so indexes wrap with a mask
+    this.buffer = new Array(INITIAL_CAPACITY);
+    this.head = 0;
+    // waiters in the buffer, including cancelled ones
+    this.size = 0;
+    // live waiters
+    this.length = 0;
+  }
+
+  push(waiter) {
+    if (this.size === this.buffer.length) {
+      this.resize(this.buffer.length * 2);
+    }
+    this.buffer[(this.head + this.size) & (this.buffer.length - 1)] = waiter;
+    this.size++;
+    this.length++;
+  }
+
+  // removes and returns the live waiter that has waited the longest
+  shift() {
+    while (this.size > 0) {
+      const waiter = this.buffer[this.head];
+      this.buffer[this.head] = undefined;
+      this.head = (this.head + 1) & (this.buffer.length - 1);
+      this.size--;
+      if (!waiter.cancelled) {
+        this.length--;
+        return waiter;
+      }
+    }
+    return undefined;
+  }
+
+  cancel(waiter) {
+    if (waiter.cancelled) {
+      return;
+    }
+    waiter.cancelled = true;
+    this.length--;
+    if (this.size > INITIAL_CAPACITY && this.size > this.length * 2) {
+      this.resize(this.buffer.length);
+    }
+  }
+
+  // copies the live waiters, in order, to the start of a new buffer
+  resize(capacity) {
+    const buffer = new Array(capacity);
+    let count = 0;
+    for (let i = 0; i < this.size; i++) {
+      const waiter = this.buffer[(this.head + i) & (this.buffer.length - 1)];
+      if (!waiter.cancelled) {
+        buffer[count] = waiter;
+        count++;
+      }
+    }
+    this.buffer = buffer;
+    this.head = 0;
+    this.size = count;
+  }
+}
+
+module.exports.WaiterQueue = WaiterQueue;
@@ -0,0 +1,70 @@
+// Readable streams passed as parameters are sent to the database with
+// SQLPutData while the statement executes. The native code cannot read a
+// stream itself, so each stream is replaced by a function that it calls for
+// every chunk it needs, as producer(callback), and that calls back with
+// (error, chunk), where chunk is a Buffer, or null once the stream has ended.
+// The next chunk is only read from the stream once the driver has taken the
+// last one.
+
+function isReadableStream(value) {
+  return value !== null
+    && typeof value === 'object'
+    && typeof value.pipe === 'function'
+    && typeof value[Symbol.asyncIterator] === 'function';
+}
+
+function streamProducer(stream) {
+  const iterator = stream[Symbol.asyncIterator]();
+  return (callback) => {
+    iterator.next().then(({ value, done }) => {
+      if (done) {
+        callback(null, null);
+      } else {
+        callback(null, Buffer.isBuffer(value) ? value : Buffer.from(value));
+      }
+    }, (error) => {
+      callback(error);
+    });
+  };
+}
+
+// a producer for a stream parameter, or for the stream value of a parameter
+// passed as an object, or undefined if the parameter isn't a stream
+function wrapStreamParameter(parameter) {
+  if (isReadableStream(parameter)) {
+    return streamProducer(parameter);
+  }
+  if (
+    parameter !== null
+    && typeof parameter === 'object'
+    && isReadableStream(parameter.value)
+  ) {
+    return { ...parameter, value: streamProducer(parameter.value) };
+  }
+  return undefined;
+}
+
+// Replaces the streams in an array of parameters, or in an object holding
+// the values of named parameter markers
+function wrapStreamParameters(parameters) {
+  if (parameters === null || typeof parameters !== 'object') {
+    return parameters;
+  }
+
+  let wrapped = parameters;
+  Object.keys(parameters).forEach((key) => {
+    const replacement = wrapStreamParameter(parameters[key]);
+    if (replacement === undefined) {
+      return;
+    }
+    // don't modify the parameters that were passed in
+    if (wrapped === parameters) {
+      wrapped = Array.isArray(parameters) ? parameters.slice() : { ...parameters };
+    }
+    wrapped[key] = replacement;
+  });
+
+  return wrapped;
+}
+
+module.exports.wrapStreamParameters = wrapStreamParameters;
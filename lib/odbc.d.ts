@@ -35,10 +35,14 @@ declare namespace odbc {
 
     prepare(sql: string, callback: (error: NodeOdbcError) => undefined): undefined;
 
-    bind(parameters: Array<number|string>, callback: (error: NodeOdbcError) => undefined): undefined;
+    bind(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>, callback: (error: NodeOdbcError) => undefined): undefined;
 
     execute<T>(callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
 
+    run<T>(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
+
+    run<T, O extends QueryOptions>(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
+
     close(callback: (error: NodeOdbcError) => undefined): undefined;
 
     ////////////////////////////////////////////////////////////////////////////
@@ -47,10 +51,14 @@ declare namespace odbc {
 
     prepare(sql: string): Promise<void>;
 
-    bind(parameters: Array<number|string>): Promise<void>;
+    bind(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>): Promise<void>;
 
     execute<T>(): Promise<Result<T>>;
 
+    run<T>(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>): Promise<Result<T>>;
+
+    run<T, O extends QueryOptions>(parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
+
     close(): Promise<void>;
   }
 
@@ -58,6 +66,7 @@ declare namespace odbc {
     connectionString: string;
     connectionTimeout?: number;
     loginTimeout?: number;
+    readOnly?: boolean;
   }
   interface PoolParameters {
     connectionString: string;
@@ -68,6 +77,148 @@ declare namespace odbc {
     maxSize?: number;
     reuseConnections?: boolean;
     shrink?: boolean;
+    coalesce?: boolean;
+    coalesceKey?: (sql: string, parameters: any, options: any) => string|undefined;
+    cache?: boolean|PoolCacheOptions;
+    acquireTimeoutMs?: number;
+    maxWaiting?: number;
+    maxActivelyConnecting?: number;
+    warmupConcurrency?: number;
+    minReadySize?: number;
+    minSize?: number;
+    idleTimeoutMs?: number;
+    maxLifetimeMs?: number;
+    checkConnectionDead?: boolean;
+    validationQuery?: string;
+    validateIdleMs?: number;
+    keepaliveMs?: number;
+    resetOnRelease?: boolean;
+    statsIntervalMs?: number;
+    concurrencyLimit?: boolean|ConcurrencyLimitOptions;
+    retry?: boolean|RetryOptions;
+    readOnly?: boolean;
+    priorities?: { [name: string]: number };
+    tenantLimit?: number;
+    tenantLimits?: { [tenant: string]: number };
+  }
+
+  interface PoolEndpoint extends Partial<PoolParameters> {
+    connectionString: string;
+    name?: string;
+    role?: 'primary'|'replica';
+    weight?: number;
+  }
+
+  interface PoolClusterParameters extends Partial<PoolParameters> {
+    endpoints: Array<string|PoolEndpoint>;
+    balance?: 'inFlight'|'latency';
+    ejectAfterFailures?: number;
+    reprobeIntervalMs?: number;
+    reprobeTimeoutMs?: number;
+  }
+
+  interface PoolClusterConnectOptions extends PoolConnectOptions {
+    readOnly?: boolean;
+  }
+
+  interface PoolEndpointStats {
+    name: string;
+    role: 'primary'|'replica';
+    weight: number;
+    healthy: boolean;
+    inFlight: number;
+    latency: number;
+    pool: PoolStats;
+  }
+
+  interface PoolClusterStats {
+    endpoints: Array<PoolEndpointStats>;
+  }
+
+  interface RetryOptions {
+    states?: string[];
+    maxAttempts?: number;
+    baseDelayMs?: number;
+    maxDelayMs?: number;
+  }
+
+  interface ConcurrencyLimitOptions {
+    algorithm?: 'gradient'|'aimd';
+    initialLimit?: number;
+    minLimit?: number;
+    maxLimit?: number;
+    maxQueue?: number;
+    tolerance?: number;
+    smoothing?: number;
+    latencyThresholdMs?: number;
+    backoffRatio?: number;
+  }
+
+  interface ConcurrencyLimitStats {
+    limit: number;
+    inFlight: number;
+    queued: number;
+    rejected: number;
+  }
+
+  interface HistogramSnapshot {
+    count: number;
+    min: number;
+    max: number;
+    mean: number;
+    p50: number;
+    p90: number;
+    p99: number;
+    p999: number;
+  }
+
+  interface PoolStats {
+    size: number;
+    inUse: number;
+    idle: number;
+    connecting: number;
+    waiting: number;
+    connectFailures: number;
+    acquireTimeouts: number;
+    acquireRejections: number;
+    acquireWait: HistogramSnapshot;
+    queryDuration: HistogramSnapshot;
+    coalescing: CoalescingStats;
+    concurrencyLimit: ConcurrencyLimitStats|null;
+    retries: number;
+  }
+
+  interface PoolConnectOptions {
+    acquireTimeoutMs?: number;
+    signal?: AbortSignal;
+    priority?: string;
+    tenant?: string;
+  }
+
+  interface PoolCacheOptions {
+    maxBytes?: number;
+    ttl?: number;
+  }
+
+  interface CoalescingStats {
+    queries: number;
+    coalesced: number;
+    ratio: number;
+  }
+
+  interface TypedParameter {
+    value: any;
+    sqlType: number;
+    size?: number;
+    scale?: number;
+  }
+
+  interface NamedParameters {
+    [name: string]: number|string|Buffer|NodeJS.ReadableStream|TypedParameter|null;
+  }
+
+  interface InsertColumnsOptions {
+    batchMemory?: number;
   }
 
   interface QueryOptions {
@@ -75,6 +226,19 @@ declare namespace odbc {
     fetchSize?: number;
     timeout?: number;
     initialBufferSize?: number;
+    rowBinding?: boolean;
+    latin1?: boolean|Array<string>;
+    intern?: boolean;
+    cache?: boolean|QueryCacheOptions;
+    idempotent?: boolean;
+    readOnly?: boolean;
+    priority?: string;
+    tenant?: string;
+  }
+
+  interface QueryCacheOptions {
+    ttl?: number;
+    tags?: Array<string>;
   }
 
   interface CursorQueryOptions extends QueryOptions {
@@ -87,15 +251,19 @@ declare namespace odbc {
     //   Callbacks   ///////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
     query<T>(sql: string, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
-    query<T>(sql: string, parameters: Array<number|string>, callback: (error: NodeOdbcError, result: Result<T> | Cursor) => undefined): undefined;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, callback: (error: NodeOdbcError, result: Result<T> | Cursor) => undefined): undefined;
     query<T, O extends QueryOptions>(sql: string, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
-    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string>, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
 
     callProcedure<T>(catalog: string|null, schema: string|null, name: string, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
     callProcedure<T>(catalog: string|null, schema: string|null, name: string, parameters: Array<number|string>, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
+    insertColumns(table: string, columns: { [column: string]: ArrayBufferView }, callback: (error: NodeOdbcError, count: number) => undefined): undefined;
+    insertColumns(table: string, columns: { [column: string]: ArrayBufferView }, options: InsertColumnsOptions, callback: (error: NodeOdbcError, count: number) => undefined): undefined;
 
     createStatement(callback: (error: NodeOdbcError, statement: Statement) => undefined): undefined;
 
+    prepare(sql: string, callback: (error: NodeOdbcError, statement: Statement) => undefined): undefined;
+
     primaryKeys<T>(catalog: string|null, schema: string|null, table: string|null, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
 
     foreignKeys<T>(pkCatalog: string|null, pkSchema: string|null, pkTable: string|null, fkCatalog: string|null, fkSchema: string|null, fkTable: string|null, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
@@ -112,20 +280,25 @@ declare namespace odbc {
 
     rollback(callback: (error: NodeOdbcError) => undefined): undefined;
 
+    resetState(callback: (error: NodeOdbcError) => undefined): undefined;
+
     close(callback: (error: NodeOdbcError) => undefined): undefined;
 
     ////////////////////////////////////////////////////////////////////////////
     //   Promises   ////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
     query<T>(sql: string): Promise<Result<T>>;
-    query<T>(sql: string, parameters: Array<number|string>): Promise<Result<T>>;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters): Promise<Result<T>>;
     query<T, O extends QueryOptions>(sql: string, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
-    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string>, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
 
     callProcedure<T>(catalog: string|null, schema: string|null, name: string, parameters?: Array<number|string>): Promise<Result<T>>;
+    insertColumns(table: string, columns: { [column: string]: ArrayBufferView }, options?: InsertColumnsOptions): Promise<number>;
 
     createStatement(): Promise<Statement>;
 
+    prepare(sql: string): Promise<Statement>;
+
     primaryKeys<T>(catalog: string|null, schema: string|null, table: string|null):  Promise<Result<T>>;
 
     foreignKeys<T>(pkCatalog: string|null, pkSchema: string|null, pkTable: string|null, fkCatalog: string|null, fkSchema: string|null, fkTable: string|null):  Promise<Result<T>>;
@@ -142,6 +315,8 @@ declare namespace odbc {
 
     rollback(): Promise<void>;
 
+    resetState(): Promise<void>;
+
     close(): Promise<void>;
   }
 
@@ -151,11 +326,12 @@ declare namespace odbc {
     //   Callbacks   ///////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
     connect(callback: (error: NodeOdbcError, connection: Connection) => undefined): undefined;
+    connect(options: PoolConnectOptions, callback: (error: NodeOdbcError, connection: Connection) => undefined): undefined;
 
     query<T>(sql: string, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
-    query<T>(sql: string, parameters: Array<number|string>, callback: (error: NodeOdbcError, result: Result<T> | Cursor) => undefined): undefined;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, callback: (error: NodeOdbcError, result: Result<T> | Cursor) => undefined): undefined;
     query<T, O extends QueryOptions>(sql: string, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
-    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string>, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
 
     close(callback: (error: NodeOdbcError) => undefined): undefined;
 
@@ -163,14 +339,69 @@ declare namespace odbc {
     ////////////////////////////////////////////////////////////////////////////
     //   Promises   ////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////
-    connect(): Promise<Connection>;
+    connect(options?: PoolConnectOptions): Promise<Connection>;
 
     query<T>(sql: string): Promise<Result<T>>;
-    query<T>(sql: string, parameters: Array<number|string>): Promise<Result<T>>;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters): Promise<Result<T>>;
     query<T, O extends QueryOptions>(sql: string, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
-    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string>, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
 
     close(): Promise<void>;
+
+    stats(): PoolStats;
+
+    coalescingStats(): CoalescingStats;
+
+    invalidate(tag: string): void;
+
+    batchLoader<T>(sqlTemplate: string, options: BatchLoaderOptions<T>): BatchLoader<T>;
+  }
+
+  class PoolCluster {
+
+    ////////////////////////////////////////////////////////////////////////////
+    //   Callbacks   ///////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////
+    connect(callback: (error: NodeOdbcError, connection: Connection) => undefined): undefined;
+    connect(options: PoolClusterConnectOptions, callback: (error: NodeOdbcError, connection: Connection) => undefined): undefined;
+
+    query<T>(sql: string, callback: (error: NodeOdbcError, result: Result<T>) => undefined): undefined;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, callback: (error: NodeOdbcError, result: Result<T> | Cursor) => undefined): undefined;
+    query<T, O extends QueryOptions>(sql: string, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O, callback: (error: NodeOdbcError, result: O extends CursorQueryOptions ? Cursor : Result<T>) => undefined): undefined;
+
+    close(callback: (error: NodeOdbcError) => undefined): undefined;
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    //   Promises   ////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////
+    connect(options?: PoolClusterConnectOptions): Promise<Connection>;
+
+    query<T>(sql: string): Promise<Result<T>>;
+    query<T>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters): Promise<Result<T>>;
+    query<T, O extends QueryOptions>(sql: string, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
+    query<T, O extends QueryOptions>(sql: string, parameters: Array<number|string|Buffer|NodeJS.ReadableStream|TypedParameter>|NamedParameters, options: O): O extends CursorQueryOptions ? Promise<Cursor> : Promise<Result<T>>;
+
+    close(): Promise<void>;
+
+    stats(): PoolClusterStats;
+
+    coalescingStats(): CoalescingStats;
+
+    invalidate(tag: string): void;
+
+    batchLoader<T>(sqlTemplate: string, options: BatchLoaderOptions<T> & { readOnly?: boolean }): BatchLoader<T>;
+  }
+
+  interface BatchLoaderOptions<T> {
+    key: string|((row: T) => any);
+    maxBatch?: number;
+  }
+
+  class BatchLoader<T> {
+    load(key: any): Promise<Array<T>>;
+    loadMany(keys: Array<any>): Promise<Array<Array<T>>>;
   }
 
   class Cursor {
@@ -202,9 +433,11 @@ declare namespace odbc {
 
   function pool(connectionString: string, callback: (error: NodeOdbcError, pool: Pool) => undefined): undefined;
   function pool(connectionObject: PoolParameters, callback: (error: NodeOdbcError, pool: Pool) => undefined): undefined;
+  function pool(clusterObject: PoolClusterParameters, callback: (error: NodeOdbcError, pool: PoolCluster) => undefined): undefined;
 
   function pool(connectionString: string): Promise<Pool>;
   function pool(connectionObject: PoolParameters): Promise<Pool>;
+  function pool(clusterObject: PoolClusterParameters): Promise<PoolCluster>;
 }
 
 export = odbc;
@@ -7,6 +7,7 @@ const nativeOdbc = require(bindingPath);
 
 const { Connection } = require('./Connection');
 const { Pool } = require('./Pool');
+const { PoolCluster } = require('./PoolCluster');
 
 function connect(connectionString, callback) {
   if (typeof callback !== 'function') {
@@ -31,7 +32,10 @@ function connect(connectionString, callback) {
 }
 
 function pool(options, callback) {
-  const poolObj = new Pool(options);
+  // several connection strings make a Pool for each, used as one
+  const poolObj = typeof options === 'object' && options !== null && Array.isArray(options.endpoints)
+    ? new PoolCluster(options)
+    : new Pool(options);
 
   if (typeof callback !== 'function') {
     return new Promise(async (resolve, reject) => {
@@ -18,6 +18,8 @@
 
 #include <time.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 
 #include "odbc.h"
 #include "odbc_connection.h"
@@ -44,11 +46,41 @@ size_t strlen16(const char16_t* string)
    return str - string;
 }
 
+// Bounded strlen16, for scanning buffers whose length the driver didn't
+// report. Looks at four code units at a time, checking for a zero code unit
+// with the usual has-zero bit trick before finding its exact position.
+size_t strnlen16(const char16_t* string, size_t max_length)
+{
+  const uint64_t low_bits  = 0x0001000100010001ULL;
+  const uint64_t high_bits = 0x8000800080008000ULL;
+  size_t index = 0;
+
+  for (; index + 4 <= max_length; index += 4)
+  {
+    uint64_t word;
+    memcpy(&word, string + index, sizeof(word));
+    if ((word - low_bits) & ~word & high_bits)
+    {
+      break;
+    }
+  }
+
+  for (; index < max_length && string[index] != 0; index++);
+
+  return index;
+}
+
 // error strings
 const char* ODBC_ERRORS = "odbcErrors\0";
 const char* STATE       = "state\0";
 const char* CODE        = "code\0";
 const char* MESSAGE     = "message\0";
+
+// parameter object keys
+const char* VALUE_PROPERTY    = "value";
+const char* SQL_TYPE_PROPERTY = "sqlType";
+const char* SIZE_PROPERTY     = "size";
+const char* SCALE_PROPERTY    = "scale";
 #ifdef UNICODE
   const SQLTCHAR NO_STATE_TEXT = L'\0';
   const SQLTCHAR* NO_MSG_TEXT = (SQLTCHAR *)L"<No error information available>\0";
@@ -465,6 +497,19 @@ class ConnectAsyncWorker : public ODBCAsyncWorker {
         return;
       }
 
+      // SQL_MODE_READ_ONLY is only a hint to the driver (it may use it to pick
+      // lighter locking, or route to a read-only server), so drivers that don't
+      // support it aren't an error
+      if (options->readOnly) {
+        SQLSetConnectAttr
+        (
+          hDBC,                                  // ConnectionHandle
+          SQL_ATTR_ACCESS_MODE,                  // Attribute
+          (SQLPOINTER) (intptr_t) SQL_MODE_READ_ONLY, // ValuePtr
+          SQL_IS_UINTEGER                        // StringLength
+        );
+      }
+
       // get information about the connection
       // maximum column length
       return_code =
@@ -595,6 +640,7 @@ Napi::Value ODBC::Connect(const Napi::CallbackInfo& info) {
   options->connectionTimeout = 0;
   options->loginTimeout = 0;
   options->fetchArray = false;
+  options->readOnly = false;
 
   if(info.Length() != 2) {
     Napi::TypeError::New(env, "connect(connectionString, callback) requires 2 parameters.").ThrowAsJavaScriptException();
@@ -622,6 +668,9 @@ Napi::Value ODBC::Connect(const Napi::CallbackInfo& info) {
     if (connectionObject.Has("fetchArray") && connectionObject.Get("fetchArray").IsBoolean()) {
       options->fetchArray = connectionObject.Get("fetchArray").As<Napi::Boolean>();
     }
+    if (connectionObject.Has("readOnly") && connectionObject.Get("readOnly").IsBoolean()) {
+      options->readOnly = connectionObject.Get("readOnly").As<Napi::Boolean>();
+    }
   } else {
     Napi::TypeError::New(env, "connect: first parameter must be a string or an object.").ThrowAsJavaScriptException();
     return env.Null();
@@ -667,6 +716,218 @@ SQLTCHAR* ODBC::NapiStringToSQLTCHAR(Napi::String string) {
  **************************** BINDING PARAMETERS ******************************
  *****************************************************************************/
 
+// Bytes needed to store a string parameter of the given number of UTF-16
+// code units, with a null terminator. Short strings are stored as UTF-8, where
+// a code unit takes at most 3 bytes (a surrogate pair takes 4 bytes for two
+// code units); long strings are stored as UTF-16.
+static size_t StringParameterSize(size_t length) {
+  if (length >= WCHAR_PARAMETER_LENGTH && sizeof(SQLWCHAR) == sizeof(char16_t)) {
+    return (length + 1) * sizeof(SQLWCHAR);
+  }
+  return length * 3 + 1;
+}
+
+// { value, sqlType, size, scale }: the caller knows the SQL type of the
+// parameter, so it doesn't have to be described with SQLDescribeParam.
+// Replaces *value with the value property of such an object, and returns true
+// with its type in description when it has a sqlType.
+static bool unwrap_typed_parameter(Napi::Value *value, ParameterDescription *description, bool *size_passed) {
+
+  if (!value->IsObject() || value->IsBuffer() || value->IsArrayBuffer() || !value->As<Napi::Object>().Has(VALUE_PROPERTY)) {
+    return false;
+  }
+
+  Napi::Object parameter_object = value->As<Napi::Object>();
+  *value = parameter_object.Get(VALUE_PROPERTY);
+
+  Napi::Value sql_type = parameter_object.Get(SQL_TYPE_PROPERTY);
+  if (!sql_type.IsNumber()) {
+    return false;
+  }
+
+  Napi::Value size  = parameter_object.Get(SIZE_PROPERTY);
+  Napi::Value scale = parameter_object.Get(SCALE_PROPERTY);
+
+  description->known         = true;
+  description->ParameterType = (SQLSMALLINT)sql_type.As<Napi::Number>().Int32Value();
+  description->ColumnSize    = size.IsNumber() ? (SQLULEN)size.As<Napi::Number>().Int64Value() : 0;
+  description->DecimalDigits = scale.IsNumber() ? (SQLSMALLINT)scale.As<Napi::Number>().Int32Value() : 0;
+  description->Nullable      = SQL_NULLABLE_UNKNOWN;
+  *size_passed               = size.IsNumber();
+  return true;
+}
+
+// Makes sure the stable value buffer of a parameter holds at least size
+// bytes. The buffer only ever grows, so after the first few binds of a
+// statement the values are written into memory that is already bound.
+static void reserve_parameter_buffer(Parameter *parameter, size_t size) {
+  if (size <= (size_t)parameter->buffer_capacity) {
+    return;
+  }
+  size_t capacity = std::max(ParameterArena::aligned(size), (size_t)parameter->buffer_capacity * 2);
+  delete[] parameter->buffer;
+  parameter->buffer = new SQLCHAR[capacity];
+  parameter->buffer_capacity = capacity;
+}
+
+// Memory for a value of size bytes: the stable buffer of the parameter when
+// storing in place, otherwise an allocation of its own
+static SQLCHAR* parameter_value_memory(Parameter *parameter, size_t size, bool in_place) {
+  if (in_place) {
+    reserve_parameter_buffer(parameter, std::max(size, (size_t)1));
+    return parameter->buffer;
+  }
+  return new SQLCHAR[size];
+}
+
+// Whether the column size of a parameter of the SQL type is a length, which
+// can be taken from the value when the caller didn't pass one
+static bool is_length_sized_type(SQLSMALLINT sql_type) {
+  switch (sql_type) {
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+    case SQL_LONGVARCHAR:
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR:
+    case SQL_BINARY:
+    case SQL_VARBINARY:
+    case SQL_LONGVARBINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+static void store_fixed_value(Parameter *parameter, T value, bool in_place) {
+  if (in_place) {
+    reserve_parameter_buffer(parameter, sizeof(T));
+    memcpy(parameter->buffer, &value, sizeof(T));
+    parameter->ParameterValuePtr = parameter->buffer;
+  } else {
+    parameter->ParameterValuePtr = new T(value);
+  }
+  parameter->StrLen_or_IndPtr = 0;
+}
+
+/*
+ * store_bind_value
+ *  Converts one JavaScript value to the C type it is bound as, and stores it
+ *  for the parameter. Strings are written into the arena when there is one,
+ *  and when in_place is true every value is written into the stable buffer of
+ *  the parameter instead of memory of its own. Functions (Readable streams)
+ *  and large Buffers are sent with SQL_DATA_AT_EXEC when data_at_execution is
+ *  true. When size_from_value is true (a sqlType was passed without a size),
+ *  the column size of a character or binary parameter is set to the length
+ *  of the value.
+ */
+static void store_bind_value(Napi::Env env, Napi::Value value, Parameter *parameter, ParameterArena *arena, bool in_place, bool data_at_execution, bool size_from_value) {
+
+  // the length of a character or binary value, which is its column size if
+  // the caller didn't pass one
+  SQLULEN value_length = 0;
+
+  if (value.IsNull()) {
+    // a bound parameter only needs its indicator changed to send NULL
+    if (!in_place || parameter->ParameterValuePtr == NULL) {
+      parameter->ValueType = SQL_C_DEFAULT;
+      parameter->ParameterValuePtr = NULL;
+    }
+    parameter->StrLen_or_IndPtr = SQL_NULL_DATA;
+  } else if (value.IsBigInt()) {
+    // TODO: need to check for signed/unsigned?
+    bool lossless = true;
+    parameter->ValueType = SQL_C_SBIGINT;
+    store_fixed_value<SQLBIGINT>(parameter, value.As<Napi::BigInt>().Int64Value(&lossless), in_place);
+    parameter->isbigint = true;
+  } else if (value.IsNumber()) {
+    double double_val = value.As<Napi::Number>().DoubleValue();
+    int64_t int_val = value.As<Napi::Number>().Int64Value();
+    if (double_val == int_val) {
+      parameter->ValueType = SQL_C_SBIGINT;
+      store_fixed_value<SQLBIGINT>(parameter, int_val, in_place);
+      parameter->isbigint = false;
+    } else {
+      parameter->ValueType = SQL_C_DOUBLE;
+      store_fixed_value<SQLDOUBLE>(parameter, double_val, in_place);
+    }
+  } else if (value.IsBoolean()) {
+    parameter->ValueType = SQL_C_BIT;
+    store_fixed_value<bool>(parameter, value.As<Napi::Boolean>().Value(), in_place);
+  } else if (data_at_execution && value.IsFunction()) {
+    // A function producing the data in chunks (a Readable stream)
+    parameter->ValueType = SQL_C_BINARY;
+    parameter->data_at_execution = new DataAtExecution(env, value.As<Napi::Function>());
+    parameter->ParameterValuePtr = parameter;
+    parameter->BufferLength = 0;
+    parameter->StrLen_or_IndPtr = SQL_DATA_AT_EXEC;
+  } else if (data_at_execution && value.IsBuffer() && value.As<Napi::Buffer<SQLCHAR>>().Length() >= DATA_AT_EXECUTION_BUFFER_SIZE) {
+    // Large Buffers are sent straight from JavaScript memory
+    Napi::Buffer<SQLCHAR> bufferValue = value.As<Napi::Buffer<SQLCHAR>>();
+    parameter->ValueType = SQL_C_BINARY;
+    parameter->data_at_execution = new DataAtExecution(bufferValue);
+    parameter->ParameterValuePtr = parameter;
+    parameter->BufferLength = 0;
+    parameter->StrLen_or_IndPtr = SQL_LEN_DATA_AT_EXEC((SQLLEN)bufferValue.Length());
+    value_length = bufferValue.Length();
+  } else if (value.IsBuffer() || value.IsArrayBuffer()) {
+    SQLCHAR *data;
+    size_t   length;
+    if (value.IsBuffer()) {
+      data   = value.As<Napi::Buffer<SQLCHAR>>().Data();
+      length = value.As<Napi::Buffer<SQLCHAR>>().Length();
+    } else {
+      data   = (SQLCHAR *)value.As<Napi::ArrayBuffer>().Data();
+      length = value.As<Napi::ArrayBuffer>().ByteLength();
+    }
+    SQLCHAR *buffer = parameter_value_memory(parameter, length, in_place);
+    memcpy(buffer, data, length);
+    parameter->ValueType = SQL_C_BINARY;
+    parameter->ParameterValuePtr = buffer;
+    parameter->BufferLength = length;
+    parameter->StrLen_or_IndPtr = length;
+    value_length = length;
+  } else if (value.IsString()) {
+    size_t length;
+    napi_get_value_string_utf16(env, value, NULL, 0, &length);
+
+    size_t bufferSize = StringParameterSize(length);
+    SQLCHAR *buffer;
+    if (!in_place && arena != NULL) {
+      buffer = arena->allocate(bufferSize);
+      parameter->inarena = true;
+    } else {
+      buffer = parameter_value_memory(parameter, bufferSize, in_place);
+    }
+    parameter->ParameterValuePtr = buffer;
+
+    if (length >= WCHAR_PARAMETER_LENGTH && sizeof(SQLWCHAR) == sizeof(char16_t)) {
+      // Large strings are copied out of V8 as UTF-16, without transcoding
+      parameter->ValueType = SQL_C_WCHAR;
+      napi_get_value_string_utf16(env, value, (char16_t *)buffer, length + 1, &length);
+      parameter->BufferLength = (length + 1) * sizeof(SQLWCHAR);
+      parameter->StrLen_or_IndPtr = length * sizeof(SQLWCHAR);
+    } else {
+      // The buffer is large enough for any UTF-8 encoding of the string,
+      // so it is transcoded straight into it with a single call
+      parameter->ValueType = SQL_C_CHAR;
+      napi_get_value_string_utf8(env, value, (char *)buffer, bufferSize, &length);
+      parameter->BufferLength = length + 1;
+      parameter->StrLen_or_IndPtr = length;
+    }
+    value_length = parameter->BufferLength;
+  } else {
+    // TODO: Throw error, don't support other types
+  }
+
+  // Character and binary SQL types need a column size, so if the caller
+  // didn't pass one, use the size of the value. Other types are left at 0.
+  if (size_from_value && value_length > 0 && is_length_sized_type(parameter->ParameterType)) {
+    parameter->ColumnSize = value_length;
+  }
+}
+
 /*
  * GetParametersFromArray
  *  Array of parameters can hold either/and:
@@ -680,8 +941,11 @@ SQLTCHAR* ODBC::NapiStringToSQLTCHAR(Napi::String string) {
  *    Objects:
  *      can hold any of the following properties (but requires at least 'value' property)
  *        value (Requited): The value to bind
- *        inOut (Optional): the In/Out type to use, Defaults to SQL_PARAM_INPUT
- *        dataType (Optional): The data type, defaults based on the value
+ *        sqlType (Optional): The SQL data type of the parameter. When passed,
+ *          the parameter isn't described with SQLDescribeParam
+ *        size (Optional): The column size of the parameter, defaults to the
+ *          size of the value for character and binary types, 0 otherwise
+ *        scale (Optional): The decimal digits of the parameter, defaults to 0
  *
  *
  */
@@ -692,72 +956,395 @@ SQLTCHAR* ODBC::NapiStringToSQLTCHAR(Napi::String string) {
 // but we can't call SQLNumParams and SQLDescribeParam until after SQLPrepare. So the array of
 // values to bind to parameters must be saved off in the closest, largest data type to then
 // convert to the right C Type once the SQL Type of the parameter is known.
-void ODBC::StoreBindValues(Napi::Array *values, Parameter **parameters) {
+void ODBC::StoreBindValues(Napi::Object *values, Parameter **parameters, ParameterArena *arena, bool dataAtExecution, const std::vector<std::string> *names) {
+
+  Napi::Env env = values->Env();
+  // with names, values is an object holding the value of each named
+  // parameter marker, otherwise it is an array of values in marker order
+  uint32_t numParameters = names != NULL ? (uint32_t)names->size() : values->As<Napi::Array>().Length();
+
+  std::vector<Napi::Value> bindValues(numParameters);
+  std::vector<bool>        sizesPassed(numParameters, false);
+  size_t                   arenaSize = 0;
+
+  // The first pass unwraps the parameters passed as objects, and adds up the
+  // memory needed for string values so the arena only has to be sized once.
+  for (uint32_t i = 0; i < numParameters; i++) {
+
+    Napi::Value value = names != NULL ? values->Get((*names)[i]) : values->Get(i);
+    Parameter *parameter = parameters[i];
+
+    parameter->described = false;
+    parameter->inarena   = false;
+
+    if (parameter->data_at_execution != NULL) {
+      delete parameter->data_at_execution;
+      parameter->data_at_execution = NULL;
+      parameter->ParameterValuePtr = NULL;
+    }
+
+    ParameterDescription description;
+    bool                 size_passed;
+    if (unwrap_typed_parameter(&value, &description, &size_passed)) {
+      parameter->ParameterType = description.ParameterType;
+      parameter->ColumnSize    = description.ColumnSize;
+      parameter->DecimalDigits = description.DecimalDigits;
+      parameter->Nullable      = description.Nullable;
+      parameter->described     = true;
+      sizesPassed[i]           = size_passed;
+    }
+
+    if (value.IsString()) {
+      size_t length;
+      napi_get_value_string_utf16(env, value, NULL, 0, &length);
+      arenaSize += ParameterArena::aligned(StringParameterSize(length));
+    }
 
+    bindValues[i] = value;
+  }
+
+  if (arena != NULL) {
+    arena->reset(arenaSize);
+  }
+
+  for (uint32_t i = 0; i < numParameters; i++) {
+    Parameter *parameter = parameters[i];
+    store_bind_value(env, bindValues[i], parameter, arena, false, dataAtExecution, parameter->described && !sizesPassed[i]);
+  }
+}
+
+/*
+ * StoreBindValuesInPlace
+ *  Stores the values of a new bind of a prepared Statement. Unlike
+ *  StoreBindValues, the values are written into stable buffers kept by each
+ *  Parameter, which are sized from the first bind and only grow when a value
+ *  doesn't fit, and the length/indicators are updated in place. Since
+ *  SQLBindParameter only takes the addresses of those, a statement whose
+ *  parameters keep the same C and SQL types doesn't have to describe or bind
+ *  its parameters again.
+ *
+ *  Returns true when the parameters have to be bound again with
+ *  SQLBindParameter, because this is the first bind or a buffer, a type or a
+ *  size changed, false when the bound buffers already hold the new values.
+ */
+bool ODBC::StoreBindValuesInPlace(Napi::Array *values, Parameter **parameters, bool bound) {
+
+  Napi::Env env = values->Env();
   uint32_t numParameters = values->Length();
+  bool needs_binding = !bound;
 
   for (uint32_t i = 0; i < numParameters; i++) {
 
     Napi::Value value = values->Get(i);
     Parameter *parameter = parameters[i];
 
-    if(value.IsNull()) {
-      parameter->ValueType = SQL_C_DEFAULT;
-      parameter->ParameterValuePtr = NULL;
-      parameter->StrLen_or_IndPtr = SQL_NULL_DATA;
-    } else if (value.IsBigInt()) {
-      // TODO: need to check for signed/unsigned?
-      bool lossless = true;
-      parameter->ValueType = SQL_C_SBIGINT;
-      parameter->ParameterValuePtr = new SQLBIGINT(value.As<Napi::BigInt>().Int64Value(&lossless));
-      parameter->isbigint = true;
-    } else if (value.IsNumber()) {
-      double double_val = value.As<Napi::Number>().DoubleValue();
-      int64_t int_val = value.As<Napi::Number>().Int64Value();
-      if (double_val == int_val) {
-        parameter->ValueType = SQL_C_SBIGINT;
-        parameter->ParameterValuePtr = new SQLBIGINT(value.As<Napi::Number>().Int64Value());
-        parameter->isbigint = false;
-      } else {
-        parameter->ValueType = SQL_C_DOUBLE;
-        parameter->ParameterValuePtr = new SQLDOUBLE(value.As<Napi::Number>().DoubleValue());
+    // the binding the parameter had for the last execution
+    SQLSMALLINT ValueType         = parameter->ValueType;
+    SQLSMALLINT ParameterType     = parameter->ParameterType;
+    SQLULEN     ColumnSize        = parameter->ColumnSize;
+    SQLSMALLINT DecimalDigits     = parameter->DecimalDigits;
+    SQLPOINTER  ParameterValuePtr = parameter->ParameterValuePtr;
+    SQLLEN      BufferLength      = parameter->BufferLength;
+
+    if (parameter->data_at_execution != NULL) {
+      delete parameter->data_at_execution;
+      parameter->data_at_execution = NULL;
+    }
+
+    ParameterDescription description;
+    bool                 size_passed = false;
+    if (unwrap_typed_parameter(&value, &description, &size_passed)) {
+      parameter->ParameterType = description.ParameterType;
+      parameter->ColumnSize    = description.ColumnSize;
+      parameter->DecimalDigits = description.DecimalDigits;
+      parameter->Nullable      = description.Nullable;
+      parameter->described     = true;
+      parameter->typed         = true;
+    } else if (parameter->typed) {
+      // the type passed for an earlier bind no longer applies, so the
+      // parameter has to be described again
+      parameter->described = false;
+      parameter->typed     = false;
+      needs_binding        = true;
+    }
+
+    store_bind_value(env, value, parameter, NULL, true, true, parameter->typed && !size_passed);
+
+    // Buffers are bound with their whole capacity, which only changes when
+    // they grow
+    if (parameter->ParameterValuePtr != NULL && parameter->ParameterValuePtr == parameter->buffer) {
+      parameter->BufferLength = parameter->buffer_capacity;
+    }
+
+    if (
+      parameter->ValueType         != ValueType     ||
+      parameter->ParameterType     != ParameterType ||
+      parameter->ColumnSize        != ColumnSize    ||
+      parameter->DecimalDigits     != DecimalDigits ||
+      parameter->ParameterValuePtr != ParameterValuePtr ||
+      parameter->BufferLength      != BufferLength
+    ) {
+      needs_binding = true;
+    }
+  }
+
+  return needs_binding;
+}
+
+// Sends the data of the parameters bound with SQL_DATA_AT_EXEC, once
+// SQLExecute (or SQLExecDirect) has returned SQL_NEED_DATA. SQLParamData
+// returns the token of each parameter it needs data for, which is the
+// Parameter itself, and finally returns the result of the execution. timeout
+// is the query timeout in seconds (0 if there is none), and error_message is
+// set when the data couldn't be sent for a reason the driver doesn't know of.
+SQLRETURN ODBC::PutDataAtExecution(SQLHSTMT hstmt, SQLULEN timeout, const char **error_message) {
+
+  SQLRETURN  return_code;
+  SQLPOINTER token;
+
+  while ((return_code = SQLParamData(hstmt, &token)) == SQL_NEED_DATA) {
+    Parameter *parameter = (Parameter *)token;
+    return_code = parameter->data_at_execution->PutData(hstmt, timeout, error_message);
+    if (!SQL_SUCCEEDED(return_code)) {
+      return return_code;
+    }
+  }
+
+  return return_code;
+}
+
+// The worker threads waiting for chunks from producer functions. Each one
+// holds a thread of the libuv threadpool while it waits, and a Readable
+// stream may need a thread of the same pool to produce its chunk (a file
+// stream does), so if every thread of the pool were waiting, no chunk could
+// ever be produced. Statements are failed instead of letting the last thread
+// of the pool wait.
+static int waiting_producer_count = 0;
+static uv_mutex_t waiting_producer_mutex;
+static uv_once_t waiting_producer_once = UV_ONCE_INIT;
+
+static void init_waiting_producer_mutex() {
+  uv_mutex_init(&waiting_producer_mutex);
+}
+
+// UV_THREADPOOL_SIZE is read by libuv when the pool starts, defaults to 4, and
+// is clamped to between 1 and 1024
+static int threadpool_size() {
+  const char *value = getenv("UV_THREADPOOL_SIZE");
+  int size = value == NULL ? 4 : atoi(value);
+  return std::max(1, std::min(size, 1024));
+}
+
+static bool start_waiting_for_producer() {
+  uv_once(&waiting_producer_once, init_waiting_producer_mutex);
+  uv_mutex_lock(&waiting_producer_mutex);
+  bool allowed = waiting_producer_count + 1 < threadpool_size();
+  if (allowed) {
+    waiting_producer_count++;
+  }
+  uv_mutex_unlock(&waiting_producer_mutex);
+  return allowed;
+}
+
+static void stop_waiting_for_producer() {
+  uv_mutex_lock(&waiting_producer_mutex);
+  waiting_producer_count--;
+  uv_mutex_unlock(&waiting_producer_mutex);
+}
+
+DataAtExecution::DataAtExecution(Napi::Buffer<SQLCHAR> buffer) {
+  this->buffer = Napi::Persistent(buffer);
+  this->data   = buffer.Data();
+  this->length = buffer.Length();
+}
+
+DataAtExecution::DataAtExecution(Napi::Env env, Napi::Function producer) {
+  this->has_producer = true;
+  this->producer = Napi::ThreadSafeFunction::New(env, producer, "odbc data at execution", 0, 1);
+  // the worker thread that calls the producer keeps the event loop alive
+  this->producer.Unref(env);
+  this->exchange = std::make_shared<ChunkExchange>();
+}
+
+DataAtExecution::~DataAtExecution() {
+  if (this->has_producer) {
+    // a producer that calls back from now on finds the exchange abandoned
+    uv_mutex_lock(&this->exchange->mutex);
+    this->exchange->abandoned = true;
+    uv_mutex_unlock(&this->exchange->mutex);
+    this->producer.Release();
+  }
+}
+
+SQLRETURN DataAtExecution::PutData(SQLHSTMT hstmt, SQLULEN timeout, const char **error_message) {
+
+  SQLRETURN return_code;
+
+  if (!this->has_producer) {
+    size_t offset = 0;
+    do {
+      size_t chunk_length = std::min((size_t)DATA_AT_EXECUTION_CHUNK_SIZE, this->length - offset);
+      return_code = SQLPutData(hstmt, this->data + offset, chunk_length);
+      if (!SQL_SUCCEEDED(return_code)) {
+        return return_code;
       }
-    } else if (value.IsBoolean()) {
-      parameter->ValueType = SQL_C_BIT;
-      parameter->ParameterValuePtr = new bool(value.As<Napi::Boolean>().Value());
-    } else if (value.IsBuffer()) {
-      Napi::Buffer<SQLCHAR> bufferValue = value.As<Napi::Buffer<SQLCHAR>>();
-      parameter->ValueType = SQL_C_BINARY;
-      parameter->BufferLength = bufferValue.Length();
-      parameter->ParameterValuePtr = new SQLCHAR[parameter->BufferLength]();
-      parameter->StrLen_or_IndPtr = parameter->BufferLength;
-      memcpy((SQLCHAR *) parameter->ParameterValuePtr, bufferValue.Data(), parameter->BufferLength);
-    } else if (value.IsArrayBuffer()) {
-      Napi::ArrayBuffer arrayBufferValue = value.As<Napi::ArrayBuffer>();
-      parameter->ValueType = SQL_C_BINARY;
-      parameter->BufferLength = arrayBufferValue.ByteLength();
-      parameter->ParameterValuePtr = new SQLCHAR[parameter->BufferLength];
-      parameter->StrLen_or_IndPtr = parameter->BufferLength;
-      memcpy((SQLCHAR *) parameter->ParameterValuePtr, arrayBufferValue.Data(), parameter->BufferLength);
-    } else if (value.IsString()) {
-      // Napi::String string = value.ToString();
-      // parameter->ValueType = SQL_C_WCHAR;
-      // parameter->BufferLength = (string.Utf16Value().length() + 1) * sizeof(SQLWCHAR);
-      // parameter->ParameterValuePtr = new SQLWCHAR[parameter->BufferLength];
-      // parameter->StrLen_or_IndPtr = SQL_NTS;
-      // memcpy((SQLWCHAR*) parameter->ParameterValuePtr, string.Utf16Value().c_str(), parameter->BufferLength);
-      Napi::String string = value.ToString();
-      parameter->ValueType = SQL_C_CHAR;
-      parameter->BufferLength = (string.Utf8Value().length() + 1);
-      parameter->ParameterValuePtr = new SQLCHAR[parameter->BufferLength]();
-      parameter->StrLen_or_IndPtr = SQL_NTS;
-      memcpy((SQLCHAR*) parameter->ParameterValuePtr, string.Utf8Value().c_str(), parameter->BufferLength);
-    } else {
-      // TODO: Throw error, don't support other types
+      offset += chunk_length;
+    } while (offset < this->length);
+    return return_code;
+  }
+
+  if (!start_waiting_for_producer()) {
+    *error_message = "[odbc] Too many statements are reading stream parameters at once for the libuv threadpool. Increase UV_THREADPOOL_SIZE\0";
+    return SQL_ERROR;
+  }
+
+  ChunkExchange *exchange = this->exchange.get();
+  bool data_sent = false;
+  return_code = SQL_SUCCESS;
+
+  uv_mutex_lock(&exchange->mutex);
+  exchange->abandoned = false;
+  exchange->finished  = false;
+  exchange->failed    = false;
+  uv_mutex_unlock(&exchange->mutex);
+
+  // The whole stream has to be sent within the query timeout, or each chunk
+  // within DATA_AT_EXECUTION_CHUNK_TIMEOUT if there is none
+  uint64_t deadline = timeout > 0 ? uv_hrtime() + (uint64_t)timeout * 1000000000 : 0;
+
+  // Only request the next chunk once the last one was sent, so that a
+  // Readable stream is only read as fast as the driver takes its data
+  while (true) {
+    uv_mutex_lock(&exchange->mutex);
+    exchange->chunk_ready = false;
+    exchange->sequence++;
+    unsigned int sequence = exchange->sequence;
+    uv_mutex_unlock(&exchange->mutex);
+
+    // the call owns a reference to the exchange until it has run
+    ChunkRequest *request = new ChunkRequest { this->exchange, sequence };
+    napi_status status = this->producer.BlockingCall(request, [](Napi::Env env, Napi::Function producer, ChunkRequest *request) {
+      DataAtExecution::RequestChunk(env, producer, request->exchange, request->sequence);
+      delete request;
+    });
+    if (status != napi_ok) {
+      delete request;
+      return_code = SQL_ERROR;
+      break;
+    }
+
+    uint64_t chunk_deadline = deadline != 0
+      ? deadline
+      : uv_hrtime() + (uint64_t)DATA_AT_EXECUTION_CHUNK_TIMEOUT * 1000000;
+    bool timed_out = false;
+
+    uv_mutex_lock(&exchange->mutex);
+    while (!exchange->chunk_ready) {
+      uint64_t now = uv_hrtime();
+      if (now >= chunk_deadline ||
+          uv_cond_timedwait(&exchange->condition, &exchange->mutex, chunk_deadline - now) == UV_ETIMEDOUT) {
+        if (!exchange->chunk_ready) {
+          timed_out = true;
+          break;
+        }
+      }
+    }
+    uv_mutex_unlock(&exchange->mutex);
+
+    if (timed_out) {
+      *error_message = "[odbc] Timed out waiting for the data of a stream parameter\0";
+      return_code = SQL_ERROR;
+      break;
+    }
+
+    if (exchange->failed) {
+      *error_message = "[odbc] Error reading the data of a stream parameter\0";
+      return_code = SQL_ERROR;
+      break;
+    }
+
+    if (exchange->finished) {
+      break;
+    }
+
+    if (exchange->chunk.size() > 0) {
+      return_code = SQLPutData(hstmt, exchange->chunk.data(), exchange->chunk.size());
+      if (!SQL_SUCCEEDED(return_code)) {
+        break;
+      }
+      data_sent = true;
+    }
+  }
+
+  // whether it finished or gave up, the worker doesn't take any more chunks
+  uv_mutex_lock(&exchange->mutex);
+  exchange->abandoned = true;
+  uv_mutex_unlock(&exchange->mutex);
+  stop_waiting_for_producer();
+
+  if (!SQL_SUCCEEDED(return_code)) {
+    return return_code;
+  }
+
+  // an empty stream is sent as a zero-length value
+  if (!data_sent) {
+    SQLCHAR empty = 0;
+    return SQLPutData(hstmt, &empty, 0);
+  }
+
+  return SQL_SUCCESS;
+}
+
+// Runs on the main thread: calls the producer with a callback that receives
+// the next chunk, as (error, chunk), where chunk is a Buffer or null at the
+// end of the data. The callback holds its own reference to the exchange.
+void DataAtExecution::RequestChunk(Napi::Env env, Napi::Function producer, std::shared_ptr<ChunkExchange> exchange, unsigned int sequence) {
+
+  Napi::Function callback = Napi::Function::New(env, [exchange, sequence](const Napi::CallbackInfo& info) {
+    DataAtExecution::ReceiveChunk(info, exchange, sequence);
+  });
+
+  producer.Call({ callback });
+
+  if (env.IsExceptionPending()) {
+    env.GetAndClearPendingException();
+    uv_mutex_lock(&exchange->mutex);
+    if (!exchange->chunk_ready && !exchange->abandoned && exchange->sequence == sequence) {
+      exchange->failed = true;
+      exchange->chunk_ready = true;
+      uv_cond_signal(&exchange->condition);
     }
+    uv_mutex_unlock(&exchange->mutex);
   }
 }
 
+void DataAtExecution::ReceiveChunk(const Napi::CallbackInfo& info, const std::shared_ptr<ChunkExchange> &exchange, unsigned int sequence) {
+
+  uv_mutex_lock(&exchange->mutex);
+
+  // the producer already called back for this chunk, or the worker thread
+  // isn't waiting for it any more
+  if (exchange->chunk_ready || exchange->abandoned || exchange->sequence != sequence) {
+    uv_mutex_unlock(&exchange->mutex);
+    return;
+  }
+
+  if (info.Length() > 0 && !info[0].IsNull() && !info[0].IsUndefined()) {
+    exchange->failed = true;
+  } else if (info.Length() < 2 || info[1].IsNull() || info[1].IsUndefined()) {
+    exchange->finished = true;
+  } else if (info[1].IsBuffer()) {
+    Napi::Buffer<SQLCHAR> chunk = info[1].As<Napi::Buffer<SQLCHAR>>();
+    exchange->chunk.assign(chunk.Data(), chunk.Data() + chunk.Length());
+  } else {
+    exchange->failed = true;
+  }
+
+  exchange->chunk_ready = true;
+  uv_cond_signal(&exchange->condition);
+  uv_mutex_unlock(&exchange->mutex);
+}
+
 SQLRETURN ODBC::DescribeParameters(SQLHSTMT hstmt, Parameter **parameters, SQLSMALLINT parameterCount) {
 
   SQLRETURN return_code = SQL_SUCCESS; // if no parameters, will return SQL_SUCCESS
@@ -769,6 +1356,11 @@ SQLRETURN ODBC::DescribeParameters(SQLHSTMT hstmt, Parameter **parameters, SQLSM
     // "Except in calls to procedures, all parameters in SQL statements are input parameters."
     parameter->InputOutputType = SQL_PARAM_INPUT;
 
+    // the caller passed the parameter's type, or it was already described
+    if (parameter->described) {
+      continue;
+    }
+
     return_code =
     SQLDescribeParam
     (
@@ -784,6 +1376,8 @@ SQLRETURN ODBC::DescribeParameters(SQLHSTMT hstmt, Parameter **parameters, SQLSM
     if (!SQL_SUCCEEDED(return_code)) {
       return return_code;
     }
+
+    parameter->described = true;
   }
 
   return return_code;
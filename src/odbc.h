@@ -29,6 +29,9 @@
 #include <new>
 
 #include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
 
 #include <stdlib.h>
 #ifdef dynodbc
@@ -41,6 +44,20 @@
 #define MAX_FIELD_SIZE 1024
 #define MAX_VALUE_SIZE 1048576
 
+// Buffer parameters of at least this many bytes are bound as
+// SQL_DATA_AT_EXEC and sent from JavaScript memory with SQLPutData, in chunks
+// of DATA_AT_EXECUTION_CHUNK_SIZE bytes, instead of being copied
+#define DATA_AT_EXECUTION_BUFFER_SIZE 4194304
+#define DATA_AT_EXECUTION_CHUNK_SIZE 1048576
+
+// The longest a worker thread waits for each chunk of a Readable stream
+// parameter when the query has no timeout, in milliseconds
+#define DATA_AT_EXECUTION_CHUNK_TIMEOUT 60000
+
+// String parameters of at least this many UTF-16 code units are bound as
+// SQL_C_WCHAR, so that they can be copied without transcoding them to UTF-8
+#define WCHAR_PARAMETER_LENGTH 32768
+
 #ifdef UNICODE
 #define ERROR_MESSAGE_BUFFER_BYTES 2048
 #define ERROR_MESSAGE_BUFFER_CHARS 1024
@@ -79,6 +96,7 @@ typedef struct ConnectionOptions {
   unsigned int connectionTimeout;
   unsigned int loginTimeout;
   bool         fetchArray;
+  bool         readOnly;
 } ConnectionOptions;
 
 typedef struct Column {
@@ -95,6 +113,9 @@ typedef struct Column {
   SQLSMALLINT   bind_type;   // when unraveling ColumnData
   SQLLEN        buffer_size; // size of the buffer bound
   bool          is_long_data; // set to true if data type is SQL_(W)LONG*
+  // offsets of the data and StrLen_or_Ind within a row, when bound row-wise
+  size_t        data_offset;
+  size_t        indicator_offset;
 } Column;
 
 typedef struct ColumnBuffer {
@@ -107,6 +128,72 @@ typedef struct BindData {
   SQLPOINTER data;
 } BindData;
 
+// The chunk a producer function hands from the main thread to the worker
+// thread waiting for it. It is shared (and reference counted) between the
+// DataAtExecution, the pending calls to the producer, and the callbacks passed
+// to it, so that a producer that calls back late, or more than once, after
+// the worker has stopped waiting doesn't touch freed memory.
+struct ChunkExchange {
+  uv_mutex_t           mutex;
+  uv_cond_t            condition;
+  bool                 chunk_ready = false;
+  bool                 finished    = false;
+  bool                 failed      = false;
+  // the worker stopped waiting, so any later chunk is ignored
+  bool                 abandoned   = false;
+  // the number of the chunk being waited for, so that a producer calling
+  // back twice for one chunk doesn't answer the request for the next one
+  unsigned int         sequence    = 0;
+  std::vector<SQLCHAR> chunk;
+
+  ChunkExchange() {
+    uv_mutex_init(&this->mutex);
+    uv_cond_init(&this->condition);
+  }
+  ~ChunkExchange() {
+    uv_mutex_destroy(&this->mutex);
+    uv_cond_destroy(&this->condition);
+  }
+};
+
+// A request for the chunk numbered sequence, passed to the main thread
+struct ChunkRequest {
+  std::shared_ptr<ChunkExchange> exchange;
+  unsigned int                   sequence;
+};
+
+// Data for a parameter bound with SQL_DATA_AT_EXEC, sent in chunks with
+// SQLPutData after SQLExecute returns SQL_NEED_DATA. The data comes either
+// from a large Buffer, which is referenced instead of copied, or from a
+// JavaScript function producing the data one chunk at a time, which is how
+// the JavaScript layer passes down Readable streams. Created and destroyed on
+// the main thread, PutData is called from a worker thread.
+class DataAtExecution {
+
+  public:
+    DataAtExecution(Napi::Buffer<SQLCHAR> buffer);
+    DataAtExecution(Napi::Env env, Napi::Function producer);
+    ~DataAtExecution();
+
+    SQLRETURN PutData(SQLHSTMT hstmt, SQLULEN timeout, const char **error_message);
+
+  private:
+    // Buffer data
+    Napi::Reference<Napi::Buffer<SQLCHAR>> buffer;
+    SQLCHAR *data   = NULL;
+    size_t   length = 0;
+
+    // Chunk producer, and the chunk it last produced. The worker thread waits
+    // on the exchange until the producer has called back on the main thread,
+    // or until it gives up waiting.
+    bool                           has_producer = false;
+    Napi::ThreadSafeFunction       producer;
+    std::shared_ptr<ChunkExchange> exchange;
+
+    static void RequestChunk(Napi::Env env, Napi::Function producer, std::shared_ptr<ChunkExchange> exchange, unsigned int sequence);
+    static void ReceiveChunk(const Napi::CallbackInfo& info, const std::shared_ptr<ChunkExchange> &exchange, unsigned int sequence);
+};
+
 // Amalgamation of the information returned by SQLDescribeParam and
 // SQLProcedureColumns as well as the information needed by SQLBindParameter
 typedef struct Parameter {
@@ -120,8 +207,60 @@ typedef struct Parameter {
   SQLLEN       StrLen_or_IndPtr;
   SQLSMALLINT  Nullable;
   bool         isbigint;
+  bool         described; // ParameterType, ColumnSize and DecimalDigits are known
+  bool         inarena;   // ParameterValuePtr is owned by a ParameterArena
+  bool         typed;     // ParameterType, ColumnSize and DecimalDigits were passed by the caller
+  DataAtExecution *data_at_execution; // set when bound with SQL_DATA_AT_EXEC
+  SQLCHAR     *buffer;    // value buffer of a Statement, kept across binds
+  SQLLEN       buffer_capacity;
 } Parameter;
 
+// Memory for the string parameter values of a statement. All of the strings
+// of a bind are stored in one block, which is kept and reused by later binds
+// and only reallocated when a bind needs more than it holds.
+typedef struct ParameterArena {
+  SQLCHAR *memory   = NULL;
+  size_t   capacity = 0;
+  size_t   used     = 0;
+
+  // size of an allocation in the arena, keeping every allocation aligned for
+  // SQLWCHAR data
+  static size_t aligned(size_t size) {
+    return (size + alignof(SQLWCHAR) - 1) / alignof(SQLWCHAR) * alignof(SQLWCHAR);
+  }
+
+  // Makes room for a bind's worth of allocations, whose aligned sizes add up
+  // to size. Values from a previous bind are no longer valid afterwards.
+  void reset(size_t size) {
+    if (size > this->capacity) {
+      delete[] this->memory;
+      this->memory = new SQLCHAR[size];
+      this->capacity = size;
+    }
+    this->used = 0;
+  }
+
+  SQLCHAR* allocate(size_t size) {
+    SQLCHAR *allocation = this->memory + this->used;
+    this->used += aligned(size);
+    return allocation;
+  }
+
+  ~ParameterArena() {
+    delete[] this->memory;
+  }
+} ParameterArena;
+
+// The parts of a Parameter returned by SQLDescribeParam, kept by the
+// connection so statements with the same SQL don't have to describe again
+typedef struct ParameterDescription {
+  bool         known;
+  SQLSMALLINT  ParameterType;
+  SQLULEN      ColumnSize;
+  SQLSMALLINT  DecimalDigits;
+  SQLSMALLINT  Nullable;
+} ParameterDescription;
+
 typedef struct ColumnData {
   SQLSMALLINT bind_type;
   bool use_free;
@@ -167,12 +306,25 @@ typedef struct QueryOptions {
   SQLULEN      fetch_size                    = 1;
   SQLULEN      timeout                       = 0;
   SQLLEN       initial_long_data_buffer_size = MB_SIZE;
+  bool         row_binding                   = false;
+  bool         intern                        = false;
+  // character columns whose data is ISO-8859-1 (Latin-1), either because
+  // latin1 was true or because the column was named in the latin1 array
+  bool         latin1                        = false;
+#ifdef UNICODE
+  std::vector<std::u16string> latin1_columns;
+#else
+  std::vector<std::string>    latin1_columns;
+#endif
 
   // JavaScript property keys for query options
   static constexpr const char *CURSOR_PROPERTY              = "cursor";
   static constexpr const char *FETCH_SIZE_PROPERTY          = "fetchSize";
   static constexpr const char *TIMEOUT_PROPERTY             = "timeout";
   static constexpr const char *INITIAL_BUFFER_SIZE_PROPERTY = "initialBufferSize";
+  static constexpr const char *ROW_BINDING_PROPERTY         = "rowBinding";
+  static constexpr const char *LATIN1_PROPERTY              = "latin1";
+  static constexpr const char *INTERN_PROPERTY              = "intern";
 
   void reset() {
     this->use_cursor   = false;
@@ -181,6 +333,10 @@ typedef struct QueryOptions {
     this->fetch_size = 1;
     this->timeout = 0;
     this->initial_long_data_buffer_size = MB_SIZE;
+    this->row_binding = false;
+    this->intern = false;
+    this->latin1 = false;
+    this->latin1_columns.clear();
   };
 
 } QueryOptions;
@@ -199,12 +355,20 @@ typedef struct StatementData {
   // parameters
   SQLSMALLINT parameterCount = 0;
   Parameter** parameters = NULL;
+  ParameterArena parameter_arena;
+  // the parameters of a Statement are bound to their buffers, so a bind that
+  // only changes the values doesn't have to bind them again
+  bool parameters_bound = false;
 
   // columns and rows
   bool                        simple_binding = false;
   Column                    **columns        = NULL;
   SQLSMALLINT                 column_count;
   ColumnBuffer               *bound_columns  = NULL;
+  // when bound row-wise, every bound column of a row lives in one block of
+  // row_size bytes, and bound_columns point into row_buffer
+  SQLCHAR                    *row_buffer     = NULL;
+  SQLULEN                     row_size       = 0;
   std::vector<ColumnData*>    storedRows;
   SQLLEN                      rowCount;
 
@@ -234,7 +398,18 @@ typedef struct StatementData {
 
     for (int i = 0; i < this->parameterCount; i++) {
       Parameter* parameter = this->parameters[i];
-      if (parameter->ParameterValuePtr != NULL) {
+      if (parameter->data_at_execution != NULL) {
+        // ParameterValuePtr is the parameter itself, used as the token
+        // returned by SQLParamData
+        delete parameter->data_at_execution;
+        parameter->data_at_execution = NULL;
+      }
+      else if (
+        parameter->ParameterValuePtr != NULL &&
+        parameter->ParameterValuePtr != parameter &&
+        parameter->ParameterValuePtr != parameter->buffer &&
+        !parameter->inarena
+      ) {
         switch (parameter->ValueType) {
           case SQL_C_SBIGINT:
             delete (int64_t*)parameter->ParameterValuePtr;
@@ -252,6 +427,7 @@ typedef struct StatementData {
         }
       }
       parameter->ParameterValuePtr = NULL;
+      delete[] parameter->buffer;
 
       delete parameter;
     }
@@ -277,42 +453,30 @@ typedef struct StatementData {
     this->storedRows.clear();
 
     for (int i = 0; i < this->column_count; i++) {
-      switch (this->columns[i]->bind_type) {
-        case SQL_C_CHAR:
-        case SQL_C_UTINYINT:
-        case SQL_C_BINARY:
-          delete[] (SQLCHAR *)this->bound_columns[i].buffer;
-          break;
-        case SQL_C_WCHAR:
-          delete[] (SQLWCHAR *)this->bound_columns[i].buffer;
-          break;
-        case SQL_C_DOUBLE:
-          delete[] (SQLDOUBLE *)this->bound_columns[i].buffer;
-          break;
-        case SQL_C_USHORT:
-          delete[] (SQLUSMALLINT *)this->bound_columns[i].buffer;
-          break;
-        case SQL_C_SLONG:
-          delete[] (SQLUINTEGER *)this->bound_columns[i].buffer;
-          break;
-        case SQL_C_UBIGINT:
-          delete[] (SQLUBIGINT *)this->bound_columns[i].buffer;
-          break;
+      // Bound buffers are allocated as raw bytes, regardless of bind_type. If
+      // the columns were bound row-wise, they all belong to row_buffer.
+      if (this->row_buffer == NULL) {
+        delete[] (SQLCHAR *)this->bound_columns[i].buffer;
+        delete[] this->bound_columns[i].length_or_indicator_array;
       }
 
-      delete[] this->columns[i]->ColumnName;
-      delete[] this->bound_columns[i].length_or_indicator_array;
-      delete this->columns[i];
+      if (this->columns[i] != NULL) {
+        delete[] this->columns[i]->ColumnName;
+        delete this->columns[i];
+      }
     }
     this->column_count = 0;
 
     delete[] row_status_array; row_status_array = NULL;
     delete[] columns; columns = NULL;
     delete[] bound_columns; bound_columns = NULL;
+    delete[] row_buffer; row_buffer = NULL;
+    row_size = 0;
   }
 } StatementData;
 
 size_t strlen16(const char16_t* string);
+size_t strnlen16(const char16_t* string, size_t max_length);
 
 class ODBC {
 
@@ -324,7 +488,9 @@ class ODBC {
 
     static SQLTCHAR* NapiStringToSQLTCHAR(Napi::String string);
 
-    static void StoreBindValues(Napi::Array *values, Parameter **parameters);
+    static void StoreBindValues(Napi::Object *values, Parameter **parameters, ParameterArena *arena = NULL, bool dataAtExecution = false, const std::vector<std::string> *names = NULL);
+    static bool StoreBindValuesInPlace(Napi::Array *values, Parameter **parameters, bool bound);
+    static SQLRETURN PutDataAtExecution(SQLHSTMT hstmt, SQLULEN timeout, const char **error_message);
 
     static SQLRETURN DescribeParameters(SQLHSTMT hstmt, Parameter **parameters, SQLSMALLINT parameterCount);
     static SQLRETURN  BindParameters(SQLHSTMT hstmt, Parameter **parameters, SQLSMALLINT parameterCount);
@@ -16,6 +16,12 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 #include "odbc.h"
 #include "odbc_connection.h"
 #include "odbc_statement.h"
@@ -46,17 +52,20 @@ Napi::Object ODBCConnection::Init(Napi::Env env, Napi::Object exports) {
 
     InstanceMethod("close", &ODBCConnection::Close),
     InstanceMethod("createStatement", &ODBCConnection::CreateStatement),
+    InstanceMethod("prepare", &ODBCConnection::Prepare),
     InstanceMethod("query", &ODBCConnection::Query),
     InstanceMethod("beginTransaction", &ODBCConnection::BeginTransaction),
     InstanceMethod("commit", &ODBCConnection::Commit),
     InstanceMethod("rollback", &ODBCConnection::Rollback),
     InstanceMethod("callProcedure", &ODBCConnection::CallProcedure),
+    InstanceMethod("insertColumns", &ODBCConnection::InsertColumns),
     InstanceMethod("getUsername", &ODBCConnection::GetUsername),
     InstanceMethod("primaryKeys", &ODBCConnection::PrimaryKeys),
     InstanceMethod("foreignKeys", &ODBCConnection::ForeignKeys),
     InstanceMethod("tables", &ODBCConnection::Tables),
     InstanceMethod("columns", &ODBCConnection::Columns),
     InstanceMethod("setIsolationLevel", &ODBCConnection::SetIsolationLevel),
+    InstanceMethod("resetState", &ODBCConnection::ResetState),
 
     InstanceAccessor("connected", &ODBCConnection::ConnectedGetter, nullptr),
     InstanceAccessor("autocommit", &ODBCConnection::AutocommitGetter, nullptr),
@@ -93,6 +102,21 @@ class SetIsolationLevelAsyncWorker : public ODBCAsyncWorker {
 
       SQLRETURN return_code;
 
+      // remember the isolation level the connection started with, so that
+      // resetState can restore it. Drivers that can't report it just don't
+      // have it restored.
+      bool knowsDefaultIsolationLevel = odbcConnectionObject->isolationLevelChanged;
+      if (!knowsDefaultIsolationLevel) {
+        return_code = SQLGetConnectAttr(
+          odbcConnectionObject->hDBC,                   // ConnectionHandle
+          SQL_ATTR_TXN_ISOLATION,                       // Attribute
+          &odbcConnectionObject->defaultIsolationLevel, // ValuePtr
+          SQL_IS_UINTEGER,                              // BufferLength
+          NULL                                          // StringLengthPtr
+        );
+        knowsDefaultIsolationLevel = SQL_SUCCEEDED(return_code);
+      }
+
       return_code = SQLSetConnectAttr(
         odbcConnectionObject->hDBC,  // ConnectionHandle
         SQL_ATTR_TXN_ISOLATION,      // Attribute
@@ -104,6 +128,10 @@ class SetIsolationLevelAsyncWorker : public ODBCAsyncWorker {
         SetError("[odbc] Error setting isolation level\0");
         return;
       }
+
+      odbcConnectionObject->isolationLevelChanged =
+        knowsDefaultIsolationLevel &&
+        isolationLevel != odbcConnectionObject->defaultIsolationLevel;
     }
 
     void OnOK() {
@@ -138,6 +166,138 @@ Napi::Value ODBCConnection::SetIsolationLevel(const Napi::CallbackInfo &info) {
   return env.Undefined();
 }
 
+/******************************************************************************
+ ******************************** RESET STATE *********************************
+ *****************************************************************************/
+
+// ResetStateAsyncWorker, used by ResetState function (see below)
+class ResetStateAsyncWorker : public ODBCAsyncWorker {
+
+  public:
+    ResetStateAsyncWorker(ODBCConnection *odbcConnectionObject, Napi::Function& callback) : ODBCAsyncWorker(callback),
+      odbcConnectionObject(odbcConnectionObject) {}
+
+    ~ResetStateAsyncWorker() {}
+
+  private:
+    ODBCConnection *odbcConnectionObject;
+
+    void Execute() {
+
+      SQLRETURN return_code;
+
+      // work left uncommitted by the last user of the connection
+      if (odbcConnectionObject->transactionOpen) {
+        return_code =
+        SQLEndTran
+        (
+          SQL_HANDLE_DBC,             // HandleType
+          odbcConnectionObject->hDBC, // Handle
+          SQL_ROLLBACK                // CompletionType
+        );
+        if (!SQL_SUCCEEDED(return_code)) {
+          this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+          SetError("[odbc] Error rolling back the transaction on the connection\0");
+          return;
+        }
+      }
+
+      if (odbcConnectionObject->transactionOpen) {
+        return_code =
+        SQLSetConnectAttr
+        (
+          odbcConnectionObject->hDBC,     // ConnectionHandle
+          SQL_ATTR_AUTOCOMMIT,            // Attribute
+          (SQLPOINTER) SQL_AUTOCOMMIT_ON, // ValuePtr
+          SQL_NTS                         // StringLength
+        );
+        if (!SQL_SUCCEEDED(return_code)) {
+          this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+          SetError("[odbc] Error turning on autocommit on the connection\0");
+          return;
+        }
+        odbcConnectionObject->transactionOpen = false;
+      }
+
+      if (odbcConnectionObject->isolationLevelChanged) {
+        return_code =
+        SQLSetConnectAttr
+        (
+          odbcConnectionObject->hDBC, // ConnectionHandle
+          SQL_ATTR_TXN_ISOLATION,     // Attribute
+          (SQLPOINTER) (uintptr_t) odbcConnectionObject->defaultIsolationLevel, // ValuePtr
+          SQL_NTS                     // StringLength
+        );
+        if (!SQL_SUCCEEDED(return_code)) {
+          this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+          SetError("[odbc] Error restoring the isolation level of the connection\0");
+          return;
+        }
+        odbcConnectionObject->isolationLevelChanged = false;
+      }
+    }
+
+    void OnOK() {
+
+      Napi::Env env = Env();
+      Napi::HandleScope scope(env);
+
+      std::vector<napi_value> callbackArguments;
+      callbackArguments.push_back(env.Null());
+
+      Callback().Call(callbackArguments);
+    }
+};
+
+/*
+ *  ODBCConnection::ResetState
+ *
+ *    Description: Undoes the changes made to the state of the connection
+ *                 through this object: rolls back a transaction started with
+ *                 beginTransaction and not ended, turning autocommit back on,
+ *                 and restores the isolation level. Used when a connection is
+ *                 returned to a Pool. If nothing was changed, the callback is
+ *                 called right away, without calling the driver.
+ *
+ *    Parameters:
+ *      const Napi::CallbackInfo& info:
+ *        The information passed from the JavaSript environment, including the
+ *        function arguments for 'resetState'.
+ *
+ *        info[0]: Function: callback function:
+ *            function(error)
+ *              error: An error object if the state couldn't be reset, or
+ *                     null if operation was successful.
+ *
+ *    Return:
+ *      Napi::Value:
+ *        Undefined
+ */
+Napi::Value ODBCConnection::ResetState(const Napi::CallbackInfo &info) {
+
+  Napi::Env env = info.Env();
+  Napi::HandleScope scope(env);
+
+  if (!info[0].IsFunction()) {
+    Napi::TypeError::New(env, "[odbc]: resetState(callback): first argument must be a function").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  Napi::Function callback = info[0].As<Napi::Function>();
+
+  if (!this->transactionOpen && !this->isolationLevelChanged) {
+    std::vector<napi_value> callbackArguments;
+    callbackArguments.push_back(env.Null());
+    callback.Call(callbackArguments);
+    return env.Undefined();
+  }
+
+  ResetStateAsyncWorker *worker = new ResetStateAsyncWorker(this, callback);
+  worker->Queue();
+
+  return env.Undefined();
+}
+
 Napi::Value ODBCConnection::AutocommitGetter(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   Napi::HandleScope scope(env);
@@ -167,12 +327,19 @@ ODBCConnection::ODBCConnection(const Napi::CallbackInfo& info) : Napi::ObjectWra
   this->hDBC = *(info[1].As<Napi::External<SQLHDBC>>().Data());
   this->connectionOptions = *(info[2].As<Napi::External<ConnectionOptions>>().Data());
   this->getInfoResults = *(info[3].As<Napi::External<GetInfoResults>>().Data());
+
+  this->transactionOpen = false;
+  this->isolationLevelChanged = false;
+  this->defaultIsolationLevel = 0;
+
+  uv_mutex_init(&this->parameterDescriptionsMutex);
 }
 
 
 ODBCConnection::~ODBCConnection()
 {
   this->Free();
+  uv_mutex_destroy(&this->parameterDescriptionsMutex);
 }
 
 SQLRETURN ODBCConnection::Free() {
@@ -197,6 +364,235 @@ SQLRETURN ODBCConnection::Free() {
   return return_code;
 }
 
+// The key of the SQL text of a statement in the parameter description cache
+static std::string parameter_descriptions_key(SQLTCHAR *sql) {
+#ifdef UNICODE
+  return std::string((const char *)sql, strlen16((const char16_t *)sql) * sizeof(SQLTCHAR));
+#else
+  return std::string((const char *)sql);
+#endif
+}
+
+// Describes the parameters of a prepared statement. SQLDescribeParam can cost
+// a round trip to the server for every parameter marker, so descriptions are
+// kept per connection, in a least recently used cache, and reused by later
+// statements with the same SQL text. Parameters whose types were passed in by
+// the caller are never described.
+SQLRETURN ODBCConnection::DescribeParameters(StatementData *data) {
+
+  SQLRETURN return_code = SQL_SUCCESS;
+
+  std::string key = parameter_descriptions_key(data->sql);
+
+  std::vector<bool> needs_description(data->parameterCount, false);
+  bool              any_needs_description = false;
+
+  uv_mutex_lock(&this->parameterDescriptionsMutex);
+  auto cached = this->parameterDescriptionsIndex.find(key);
+  bool cache_usable = false;
+  if (cached != this->parameterDescriptionsIndex.end()) {
+    // move the entry to the back of the list, as the most recently used
+    this->parameterDescriptions.splice(this->parameterDescriptions.end(), this->parameterDescriptions, cached->second);
+    cache_usable = cached->second->second.size() == (size_t)data->parameterCount;
+  }
+
+  for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
+    Parameter *parameter = data->parameters[i];
+    if (parameter->described) {
+      continue;
+    }
+    if (cache_usable && cached->second->second[i].known) {
+      ParameterDescription &description = cached->second->second[i];
+      parameter->ParameterType = description.ParameterType;
+      parameter->ColumnSize    = description.ColumnSize;
+      parameter->DecimalDigits = description.DecimalDigits;
+      parameter->Nullable      = description.Nullable;
+      parameter->described     = true;
+    } else {
+      needs_description[i] = true;
+      any_needs_description = true;
+    }
+  }
+  uv_mutex_unlock(&this->parameterDescriptionsMutex);
+
+  return_code = ODBC::DescribeParameters(data->hstmt, data->parameters, data->parameterCount);
+  if (!SQL_SUCCEEDED(return_code) || !any_needs_description) {
+    return return_code;
+  }
+
+  uv_mutex_lock(&this->parameterDescriptionsMutex);
+  cached = this->parameterDescriptionsIndex.find(key);
+  if (cached == this->parameterDescriptionsIndex.end()) {
+    if (this->parameterDescriptions.size() >= PARAMETER_DESCRIPTIONS_CACHE_SIZE) {
+      this->parameterDescriptionsIndex.erase(this->parameterDescriptions.front().first);
+      this->parameterDescriptions.pop_front();
+    }
+    this->parameterDescriptions.emplace_back(key, std::vector<ParameterDescription>());
+    cached = this->parameterDescriptionsIndex.emplace(key, std::prev(this->parameterDescriptions.end())).first;
+  }
+  std::vector<ParameterDescription> &descriptions = cached->second->second;
+  descriptions.resize(data->parameterCount);
+
+  for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
+    if (needs_description[i]) {
+      Parameter *parameter = data->parameters[i];
+      ParameterDescription &description = descriptions[i];
+      description.known         = true;
+      description.ParameterType = parameter->ParameterType;
+      description.ColumnSize    = parameter->ColumnSize;
+      description.DecimalDigits = parameter->DecimalDigits;
+      description.Nullable      = parameter->Nullable;
+    }
+  }
+  uv_mutex_unlock(&this->parameterDescriptionsMutex);
+
+  return return_code;
+}
+
+// Drops the cached descriptions of the parameters of a statement, after
+// binding or executing it failed. The table behind the statement may have
+// changed since they were described, so the next statement with the same SQL
+// text describes its parameters again.
+void ODBCConnection::ForgetParameterDescriptions(StatementData *data) {
+
+  std::string key = parameter_descriptions_key(data->sql);
+
+  uv_mutex_lock(&this->parameterDescriptionsMutex);
+  auto cached = this->parameterDescriptionsIndex.find(key);
+  if (cached != this->parameterDescriptionsIndex.end()) {
+    this->parameterDescriptions.erase(cached->second);
+    this->parameterDescriptionsIndex.erase(cached);
+  }
+  uv_mutex_unlock(&this->parameterDescriptionsMutex);
+}
+
+static bool is_parameter_name_start(char32_t c) {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
+}
+
+static bool is_parameter_name_char(char32_t c) {
+  return is_parameter_name_start(c) || (c >= '0' && c <= '9');
+}
+
+// Rewrites the :name parameter markers of sql to ? markers, appending the
+// name of each marker to names. Quoted strings and identifiers, comments and
+// :: casts are copied as they are. Returns false if sql also has ? markers,
+// which can't be mixed with named ones.
+template <typename CharType>
+static bool
+rewrite_named_parameters
+(
+  const CharType              *sql,
+  size_t                       length,
+  std::vector<CharType>       *rewritten,
+  std::vector<std::string>    *names
+)
+{
+  bool positional = false;
+  size_t i = 0;
+
+  rewritten->reserve(length);
+
+  while (i < length) {
+    CharType c = sql[i];
+
+    if (c == '\'' || c == '"' || c == '`') {
+      // a doubled quote inside the quotes ends and reopens them, so it is
+      // copied correctly as well
+      size_t end = i + 1;
+      while (end < length && sql[end] != c) {
+        end++;
+      }
+      end = std::min(end + 1, length);
+      rewritten->insert(rewritten->end(), sql + i, sql + end);
+      i = end;
+    } else if (c == '-' && i + 1 < length && sql[i + 1] == '-') {
+      size_t end = i;
+      while (end < length && sql[end] != '\n') {
+        end++;
+      }
+      rewritten->insert(rewritten->end(), sql + i, sql + end);
+      i = end;
+    } else if (c == '/' && i + 1 < length && sql[i + 1] == '*') {
+      size_t end = i + 2;
+      while (end + 1 < length && !(sql[end] == '*' && sql[end + 1] == '/')) {
+        end++;
+      }
+      end = std::min(end + 2, length);
+      rewritten->insert(rewritten->end(), sql + i, sql + end);
+      i = end;
+    } else if (c == ':' && i + 1 < length && sql[i + 1] == ':') {
+      rewritten->insert(rewritten->end(), sql + i, sql + i + 2);
+      i += 2;
+    } else if (
+      c == ':' &&
+      i + 1 < length &&
+      is_parameter_name_start(sql[i + 1]) &&
+      (i == 0 || !is_parameter_name_char(sql[i - 1]))
+    ) {
+      size_t start = i + 1;
+      size_t end = start;
+      while (end < length && is_parameter_name_char(sql[end])) {
+        end++;
+      }
+      // names are ASCII, so each code unit is one character
+      std::string name;
+      name.reserve(end - start);
+      for (size_t j = start; j < end; j++) {
+        name.push_back((char)sql[j]);
+      }
+      names->push_back(name);
+      rewritten->push_back('?');
+      i = end;
+    } else {
+      if (c == '?') {
+        positional = true;
+      }
+      rewritten->push_back(c);
+      i++;
+    }
+  }
+
+  return !positional;
+}
+
+// Returns the SQL rewritten from :name to ? parameter markers, with the names
+// of the markers, or NULL if the SQL has no named markers or also has ?
+// markers. Rewrites are kept in a least recently used cache, so SQL that is
+// run repeatedly is only parsed once.
+const NamedParameters* ODBCConnection::GetNamedParameters(SQLTCHAR *sql) {
+
+#ifdef UNICODE
+  size_t length = strlen16((const char16_t *)sql);
+#else
+  size_t length = strlen((const char *)sql);
+#endif
+  std::string key((const char *)sql, length * sizeof(SQLTCHAR));
+
+  auto cached = this->namedParametersIndex.find(key);
+  if (cached != this->namedParametersIndex.end()) {
+    // move the entry to the back of the list, as the most recently used
+    this->namedParameters.splice(this->namedParameters.end(), this->namedParameters, cached->second);
+  } else {
+    NamedParameters named_parameters;
+    std::vector<SQLTCHAR> rewritten;
+    if (!rewrite_named_parameters(sql, length, &rewritten, &named_parameters.names)) {
+      named_parameters.names.clear();
+    }
+    named_parameters.sql.assign((const char *)rewritten.data(), rewritten.size() * sizeof(SQLTCHAR));
+
+    if (this->namedParameters.size() >= NAMED_PARAMETERS_CACHE_SIZE) {
+      this->namedParametersIndex.erase(this->namedParameters.front().first);
+      this->namedParameters.pop_front();
+    }
+    this->namedParameters.emplace_back(key, std::move(named_parameters));
+    cached = this->namedParametersIndex.emplace(key, std::prev(this->namedParameters.end())).first;
+  }
+
+  const NamedParameters *named_parameters = &cached->second->second;
+  return named_parameters->names.empty() ? NULL : named_parameters;
+}
+
 Napi::Value ODBCConnection::ConnectedGetter(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   Napi::HandleScope scope(env);
@@ -351,7 +747,10 @@ class CreateStatementAsyncWorker : public ODBCAsyncWorker {
 
   private:
     ODBCConnection *odbcConnectionObject;
-    HSTMT           hstmt;
+    HSTMT           hstmt = SQL_NULL_HANDLE;
+    // set by prepare(), which prepares the SQL in the same worker
+    SQLTCHAR       *sql = NULL;
+    SQLSMALLINT     parameterCount = 0;
 
     void Execute() {
 
@@ -371,6 +770,33 @@ class CreateStatementAsyncWorker : public ODBCAsyncWorker {
         SetError("[odbc] Error allocating a handle to create a new Statement\0");
         return;
       }
+
+      if (sql == NULL) {
+        return;
+      }
+
+      return_code = SQLPrepare
+      (
+        hstmt,  // StatementHandle
+        sql,    // StatementText
+        SQL_NTS // TextLength
+      );
+      if (!SQL_SUCCEEDED(return_code)) {
+        this->errors = GetODBCErrors(SQL_HANDLE_STMT, hstmt);
+        SetError("[odbc] Error preparing the statement\0");
+        return;
+      }
+
+      return_code = SQLNumParams
+      (
+        hstmt,          // StatementHandle
+        &parameterCount // ParameterCountPtr
+      );
+      if (!SQL_SUCCEEDED(return_code)) {
+        this->errors = GetODBCErrors(SQL_HANDLE_STMT, hstmt);
+        SetError("[odbc] Error retrieving number of parameter markers to be bound to the statement\0");
+        return;
+      }
     }
 
     void OnOK() {
@@ -384,7 +810,21 @@ class CreateStatementAsyncWorker : public ODBCAsyncWorker {
       statementArguments.push_back(Napi::External<HSTMT>::New(env, &hstmt));
 
       // create a new ODBCStatement object as a Napi::Value
-      Napi::Value statementObject = ODBCStatement::constructor.New(statementArguments);
+      Napi::Object statementObject = ODBCStatement::constructor.New(statementArguments);
+      hstmt = SQL_NULL_HANDLE;
+
+      // hand the prepared SQL over to the statement, as Prepare would
+      if (sql != NULL) {
+        ODBCStatement *odbcStatement = ODBCStatement::Unwrap(statementObject);
+        odbcStatement->napiParameters = Napi::Persistent(Napi::Array::New(env));
+        odbcStatement->data->sql = sql;
+        odbcStatement->data->parameterCount = parameterCount;
+        odbcStatement->data->parameters = new Parameter*[parameterCount];
+        for (SQLSMALLINT i = 0; i < parameterCount; i++) {
+          odbcStatement->data->parameters[i] = new Parameter();
+        }
+        sql = NULL;
+      }
 
       std::vector<napi_value> callbackArguments;
       callbackArguments.push_back(env.Null());      // callbackArguments[0]
@@ -394,10 +834,21 @@ class CreateStatementAsyncWorker : public ODBCAsyncWorker {
     }
 
   public:
-    CreateStatementAsyncWorker(ODBCConnection *odbcConnectionObject, Napi::Function& callback) : ODBCAsyncWorker(callback),
-      odbcConnectionObject(odbcConnectionObject) {}
+    CreateStatementAsyncWorker(ODBCConnection *odbcConnectionObject, Napi::Function& callback, SQLTCHAR *sql = NULL) : ODBCAsyncWorker(callback),
+      odbcConnectionObject(odbcConnectionObject),
+      sql(sql) {}
 
-    ~CreateStatementAsyncWorker() {}
+    ~CreateStatementAsyncWorker() {
+      // the statement wasn't created, because preparing the SQL failed
+      if (hstmt != SQL_NULL_HANDLE) {
+        uv_mutex_lock(&ODBC::g_odbcMutex);
+        if (odbcConnectionObject->hDBC != SQL_NULL_HANDLE) {
+          SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        }
+        uv_mutex_unlock(&ODBC::g_odbcMutex);
+      }
+      delete[] sql;
+    }
 };
 
 /*
@@ -434,6 +885,48 @@ Napi::Value ODBCConnection::CreateStatement(const Napi::CallbackInfo& info) {
   return env.Undefined();
 }
 
+/*
+ *  ODBCConnection::Prepare
+ *
+ *    Description: Create an ODBCStatement with the SQL already prepared, in a
+ *                 single trip to the thread pool.
+ *
+ *    Parameters:
+ *      const Napi::CallbackInfo& info:
+ *        The information passed from the JavaSript environment, including the
+ *        function arguments for 'prepare'.
+ *
+ *        info[0]: String: the SQL string to prepare
+ *        info[1]: Function: callback function:
+ *            function(error, statement)
+ *              error: An error object if there was an error creating the
+ *                     statement or preparing the SQL, or null if operation
+ *                     was successful.
+ *              statement: The newly created ODBCStatement object
+ *
+ *    Return:
+ *      Napi::Value:
+ *        Undefined (results returned in callback)
+ */
+Napi::Value ODBCConnection::Prepare(const Napi::CallbackInfo& info) {
+
+  Napi::Env env = info.Env();
+  Napi::HandleScope scope(env);
+
+  if (!info[0].IsString() || !info[1].IsFunction()) {
+    Napi::TypeError::New(env, "Argument 0 must be a string , Argument 1 must be a function.").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  SQLTCHAR *sql = ODBC::NapiStringToSQLTCHAR(info[0].ToString());
+  Napi::Function callback = info[1].As<Napi::Function>();
+
+  CreateStatementAsyncWorker *worker = new CreateStatementAsyncWorker(this, callback, sql);
+  worker->Queue();
+
+  return env.Undefined();
+}
+
 /******************************************************************************
  ********************************** QUERY *************************************
  *****************************************************************************/
@@ -556,6 +1049,72 @@ parse_query_options
   }
   // END .initialBufferSize
 
+  // .rowBinding property
+  if (options_object.HasOwnProperty(QueryOptions::ROW_BINDING_PROPERTY))
+  {
+    Napi::Value row_binding_value =
+      options_object.Get(QueryOptions::ROW_BINDING_PROPERTY);
+
+    if (!row_binding_value.IsBoolean())
+    {
+      return Napi::TypeError::New(env, std::string("Connection.query options: .") + QueryOptions::ROW_BINDING_PROPERTY + " must be a BOOLEAN value.").Value();
+    }
+
+    query_options->row_binding = row_binding_value.As<Napi::Boolean>().Value();
+  }
+  // END .rowBinding
+
+  // .latin1 property
+  if (options_object.HasOwnProperty(QueryOptions::LATIN1_PROPERTY))
+  {
+    Napi::Value latin1_value =
+      options_object.Get(QueryOptions::LATIN1_PROPERTY);
+
+    if (latin1_value.IsBoolean())
+    {
+      query_options->latin1 = latin1_value.As<Napi::Boolean>().Value();
+    }
+    else if (latin1_value.IsArray())
+    {
+      Napi::Array latin1_array = latin1_value.As<Napi::Array>();
+
+      for (uint32_t i = 0; i < latin1_array.Length(); i++)
+      {
+        Napi::Value column_name_value = latin1_array.Get(i);
+
+        if (!column_name_value.IsString())
+        {
+          return Napi::TypeError::New(env, std::string("Connection.query options: .") + QueryOptions::LATIN1_PROPERTY + " must be a BOOLEAN value or an ARRAY of STRING values.").Value();
+        }
+#ifdef UNICODE
+        query_options->latin1_columns.push_back(column_name_value.As<Napi::String>().Utf16Value());
+#else
+        query_options->latin1_columns.push_back(column_name_value.As<Napi::String>().Utf8Value());
+#endif
+      }
+    }
+    else
+    {
+      return Napi::TypeError::New(env, std::string("Connection.query options: .") + QueryOptions::LATIN1_PROPERTY + " must be a BOOLEAN value or an ARRAY of STRING values.").Value();
+    }
+  }
+  // END .latin1
+
+  // .intern property
+  if (options_object.HasOwnProperty(QueryOptions::INTERN_PROPERTY))
+  {
+    Napi::Value intern_value =
+      options_object.Get(QueryOptions::INTERN_PROPERTY);
+
+    if (!intern_value.IsBoolean())
+    {
+      return Napi::TypeError::New(env, std::string("Connection.query options: .") + QueryOptions::INTERN_PROPERTY + " must be a BOOLEAN value.").Value();
+    }
+
+    query_options->intern = intern_value.As<Napi::Boolean>().Value();
+  }
+  // END .intern
+
   return env.Null();
 }
 
@@ -717,7 +1276,7 @@ class QueryAsyncWorker : public ODBCAsyncWorker {
   private:
 
     ODBCConnection               *odbcConnectionObject;
-    Napi::Reference<Napi::Array>  napiParameters;
+    Napi::Reference<Napi::Object> napiParameters;
     StatementData                *data;
 
     void Execute() {
@@ -815,7 +1374,7 @@ class QueryAsyncWorker : public ODBCAsyncWorker {
             return;
           }
 
-          return_code = ODBC::DescribeParameters(data->hstmt, data->parameters, data->parameterCount);
+          return_code = odbcConnectionObject->DescribeParameters(data);
           if (!SQL_SUCCEEDED(return_code)) {
             this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
             SetError("[odbc] Error getting information about parameters\0");
@@ -825,13 +1384,25 @@ class QueryAsyncWorker : public ODBCAsyncWorker {
           return_code = ODBC::BindParameters(data->hstmt, data->parameters, data->parameterCount);
           if (!SQL_SUCCEEDED(return_code)) {
             this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+            odbcConnectionObject->ForgetParameterDescriptions(data);
             SetError("[odbc] Error binding parameters\0");
             return;
           }
 
           return_code = SQLExecute(data->hstmt);
-          if (!SQL_SUCCEEDED(return_code) && return_code != SQL_NO_DATA) {
+          if (return_code == SQL_NEED_DATA) {
+            const char *error_message = "[odbc] Error sending data at execution for the sql statement\0";
+            return_code = ODBC::PutDataAtExecution(data->hstmt, data->query_options.timeout, &error_message);
+            if (!SQL_SUCCEEDED(return_code) && return_code != SQL_NO_DATA) {
+              this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+              SQLCancel(data->hstmt);
+              SetError(error_message);
+              return;
+            }
+          }
+          if (!SQL_SUCCEEDED(return_code) && return_code != SQL_NO_DATA) {
             this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+            odbcConnectionObject->ForgetParameterDescriptions(data);
             SetError("[odbc] Error executing the sql statement\0");
             return;
           }
@@ -979,7 +1550,7 @@ class QueryAsyncWorker : public ODBCAsyncWorker {
     QueryAsyncWorker
     (
       ODBCConnection *odbcConnectionObject,
-      Napi::Array     napiParameterArray,
+      Napi::Object    napiParameterArray,
       StatementData  *data,
       Napi::Function& callback
     ) 
@@ -988,7 +1559,7 @@ class QueryAsyncWorker : public ODBCAsyncWorker {
     odbcConnectionObject(odbcConnectionObject),
     data(data)
     {
-      napiParameters = Napi::Persistent(napiParameterArray.As<Napi::Array>());
+      napiParameters = Napi::Persistent(napiParameterArray);
     }
 
     ~QueryAsyncWorker() {
@@ -1046,7 +1617,7 @@ Napi::Value ODBCConnection::Query(const Napi::CallbackInfo& info) {
                  data->fetch_array         = this->connectionOptions.fetchArray;
                  data->maxColumnNameLength = this->getInfoResults.max_column_name_length;
                  data->get_data_supports   = this->getInfoResults.sql_get_data_supports;
-  Napi::Array    napiParameterArray = Napi::Array::New(env);
+  Napi::Object   napiParameterArray = Napi::Array::New(env);
   size_t         argument_count     = info.Length();
 
   // For the C++ node-addon-api code, all of the function signatures must
@@ -1061,7 +1632,7 @@ Napi::Value ODBCConnection::Query(const Napi::CallbackInfo& info) {
     info[0].IsUndefined() ||
     !info[0].IsString()   ||
     !(
-      info[1].IsArray() ||
+      info[1].IsObject() ||
       info[1].IsNull() ||
       info[1].IsUndefined()
     ) ||
@@ -1075,7 +1646,7 @@ Napi::Value ODBCConnection::Query(const Napi::CallbackInfo& info) {
     !info[3].IsFunction()
   )
   {
-    Napi::TypeError::New(env, "[node-odbc]: Wrong function signature in call to Connection.query({string}, {array}[optional], {object}[optional], {function}).").ThrowAsJavaScriptException();
+    Napi::TypeError::New(env, "[node-odbc]: Wrong function signature in call to Connection.query({string}, {array|object}[optional], {object}[optional], {function}).").ThrowAsJavaScriptException();
     return env.Null();
   }
 
@@ -1086,16 +1657,57 @@ Napi::Value ODBCConnection::Query(const Napi::CallbackInfo& info) {
   // Store the callback function to call at the end of the AsyncWorker
   Napi::Function callback = info[3].As<Napi::Function>();
 
-  // If info[1] is not null or undefined, it is an array holding our parameters
-  if (!(info[1].IsNull() || info[1].IsUndefined()))
+  // If info[1] is an array, it is holding our parameters
+  if (info[1].IsArray())
   {
     napiParameterArray = info[1].As<Napi::Array>();
-    data->parameterCount = (SQLSMALLINT)napiParameterArray.Length();
+    data->parameterCount = (SQLSMALLINT)napiParameterArray.As<Napi::Array>().Length();
     data->parameters = new Parameter*[data->parameterCount];
     for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
       data->parameters[i] = new Parameter();
     }
-    ODBC::StoreBindValues(&napiParameterArray, data->parameters);
+    ODBC::StoreBindValues(&napiParameterArray, data->parameters, &data->parameter_arena, true);
+  }
+  // If info[1] is any other object, it is holding the values of the :name
+  // parameter markers in the SQL, which is rewritten to use ? markers
+  else if (info[1].IsObject())
+  {
+    napiParameterArray = info[1].As<Napi::Object>();
+
+    const NamedParameters *named_parameters = this->GetNamedParameters(data->sql);
+    std::string missing_name;
+    if (named_parameters != NULL) {
+      for (const std::string &name : named_parameters->names) {
+        if (!napiParameterArray.Has(name)) {
+          missing_name = name;
+          break;
+        }
+      }
+    }
+
+    if (named_parameters == NULL || !missing_name.empty()) {
+      std::string message = named_parameters == NULL
+        ? "[node-odbc]: Parameters passed as an object can only be bound to SQL with :name parameter markers, and no ? parameter markers."
+        : "[node-odbc]: No value was passed for the parameter marker :" + missing_name + ".";
+      std::vector<napi_value> callback_argument =
+      {
+        Napi::Error::New(env, message).Value()
+      };
+      delete data;
+      callback.Call(callback_argument);
+      return env.Undefined();
+    }
+
+    delete[] data->sql;
+    data->sql = new SQLTCHAR[named_parameters->sql.size() / sizeof(SQLTCHAR) + 1]();
+    memcpy(data->sql, named_parameters->sql.data(), named_parameters->sql.size());
+
+    data->parameterCount = (SQLSMALLINT)named_parameters->names.size();
+    data->parameters = new Parameter*[data->parameterCount];
+    for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
+      data->parameters[i] = new Parameter();
+    }
+    ODBC::StoreBindValues(&napiParameterArray, data->parameters, &data->parameter_arena, true, &named_parameters->names);
   }
 
   Napi::Value   error;
@@ -1159,68 +1771,513 @@ void ODBCConnection::ParametersToArray(Napi::Reference<Napi::Array> *napiParamet
   Napi::Array napiArray = napiParameters->Value();
   Napi::Env env = napiParameters->Env();
 
-  for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
-    Parameter *parameter = parameters[i];
-    if (overwriteParameters[i] == 1) {
-      Napi::Value value;
+  for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
+    Parameter *parameter = parameters[i];
+    if (overwriteParameters[i] == 1) {
+      Napi::Value value;
+
+      // check for null data
+      if (parameter->StrLen_or_IndPtr == SQL_NULL_DATA) {
+        value = env.Null();
+      } else {
+        // Create a JavaScript value based on the C type that was bound to
+        switch(parameter->ValueType) {
+          case SQL_C_DOUBLE:
+            value = Napi::Number::New(env, *(double*)parameter->ParameterValuePtr);
+            break;
+          case SQL_C_SLONG:
+            value = Napi::Number::New(env, *(SQLINTEGER*)parameter->ParameterValuePtr);
+            break;
+          case SQL_C_ULONG:
+            value = Napi::Number::New(env, *(SQLUINTEGER*)parameter->ParameterValuePtr);
+            break;
+          // Napi::BigInt
+          case SQL_C_SBIGINT:
+            if (parameter->isbigint ==  true) {
+              value = Napi::BigInt::New(env, *(int64_t*)parameter->ParameterValuePtr);
+            } else {
+              value = Napi::Number::New(env, *(int64_t*)parameter->ParameterValuePtr);
+            }
+            break;
+          case SQL_C_UBIGINT:
+            if (parameter->isbigint ==  true) {
+              value = Napi::BigInt::New(env, *(uint64_t*)parameter->ParameterValuePtr);
+            } else {
+              value = Napi::Number::New(env, *(uint64_t*)parameter->ParameterValuePtr);
+            }
+            break;
+          case SQL_C_SSHORT:
+            value = Napi::Number::New(env, *(signed short*)parameter->ParameterValuePtr);
+            break;
+          case SQL_C_USHORT:
+            value = Napi::Number::New(env, *(unsigned short*)parameter->ParameterValuePtr);
+            break;
+          // Napi::ArrayBuffer
+          case SQL_C_BINARY:
+            // value = Napi::Buffer<SQLCHAR>::New(env, (SQLCHAR*)parameter->ParameterValuePtr, *parameter->StrLen_or_IndPtr);
+            value = Napi::Buffer<SQLCHAR>::Copy(env, (SQLCHAR*)parameter->ParameterValuePtr, parameter->StrLen_or_IndPtr);
+            break;
+          // Napi::String (char16_t)
+          case SQL_C_WCHAR:
+            value = Napi::String::New(env, (const char16_t*)parameter->ParameterValuePtr, parameter->StrLen_or_IndPtr/sizeof(SQLWCHAR));
+            break;
+          // Napi::String (char)
+          case SQL_C_CHAR:
+          default:
+            value = Napi::String::New(env, (const char*)parameter->ParameterValuePtr);
+            break;
+        }
+      }
+      napiArray.Set(i, value);
+    } 
+  }
+}
+
+
+/******************************************************************************
+ ****************************** INSERT COLUMNS ********************************
+ *****************************************************************************/
+
+// A column of values for InsertColumns, bound straight from the memory of a
+// TypedArray as a column-wise array of parameters
+typedef struct InsertColumn {
+  SQLCHAR     *data;
+  size_t       element_size;
+  SQLSMALLINT  ValueType;
+  SQLSMALLINT  ParameterType;
+} InsertColumn;
+
+// InsertColumnsAsyncWorker, used by InsertColumns function (see below)
+class InsertColumnsAsyncWorker : public ODBCAsyncWorker {
+
+  private:
+
+    ODBCConnection               *odbcConnectionObject;
+    Napi::Reference<Napi::Array>  napiColumns;
+    StatementData                *data;
+    std::vector<InsertColumn>     columns;
+    size_t                        row_count;
+    size_t                        rows_per_batch;
+    SQLLEN                        inserted_count = 0;
+
+    void Execute() {
+
+      SQLRETURN return_code;
+
+      // allocate a new statement handle
+      uv_mutex_lock(&ODBC::g_odbcMutex);
+      if (odbcConnectionObject->hDBC == SQL_NULL_HANDLE) {
+        uv_mutex_unlock(&ODBC::g_odbcMutex);
+        SetError("[odbc] Database connection handle was no longer valid. Cannot insert columns after closing the connection.");
+        return;
+      }
+      return_code = SQLAllocHandle(
+        SQL_HANDLE_STMT,            // HandleType
+        odbcConnectionObject->hDBC, // InputHandle
+        &(data->hstmt)              // OutputHandlePtr
+      );
+      uv_mutex_unlock(&ODBC::g_odbcMutex);
+      if (!SQL_SUCCEEDED(return_code)) {
+        this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+        SetError("[odbc] Error allocating a handle to insert the columns\0");
+        return;
+      }
+
+      if (row_count == 0) {
+        return;
+      }
+
+      return_code =
+      SQLPrepare
+      (
+        data->hstmt,
+        data->sql,
+        SQL_NTS
+      );
+      if (!SQL_SUCCEEDED(return_code)) {
+        this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+        SetError("[odbc] Error preparing the SQL statement\0");
+        return;
+      }
+
+      return_code =
+      SQLSetStmtAttr
+      (
+        data->hstmt,
+        SQL_ATTR_PARAM_BIND_TYPE,
+        (SQLPOINTER) SQL_PARAM_BIND_BY_COLUMN,
+        IGNORED_PARAMETER
+      );
+      if (!SQL_SUCCEEDED(return_code)) {
+        this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+        SetError("[odbc] Error setting column-wise parameter binding on the statement\0");
+        return;
+      }
+
+      // The batches are only all-or-nothing if they run in one transaction.
+      // With autocommit on, each execution would be committed on its own, so
+      // a failure part of the way through would leave the earlier batches
+      // inserted. A caller that turned autocommit off already has its own
+      // transaction, and decides what to do with it.
+      bool own_transaction = false;
+      if (row_count > rows_per_batch) {
+        SQLUINTEGER autocommit = SQL_AUTOCOMMIT_OFF;
+        return_code =
+        SQLGetConnectAttr
+        (
+          odbcConnectionObject->hDBC, // ConnectionHandle
+          SQL_ATTR_AUTOCOMMIT,        // Attribute
+          &autocommit,                // ValuePtr
+          0,                          // BufferLength
+          NULL                        // StringLengthPtr
+        );
+        if (SQL_SUCCEEDED(return_code) && autocommit == SQL_AUTOCOMMIT_ON) {
+          return_code =
+          SQLSetConnectAttr
+          (
+            odbcConnectionObject->hDBC,      // ConnectionHandle
+            SQL_ATTR_AUTOCOMMIT,             // Attribute
+            (SQLPOINTER) SQL_AUTOCOMMIT_OFF, // ValuePtr
+            SQL_NTS                          // StringLength
+          );
+          if (!SQL_SUCCEEDED(return_code)) {
+            this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+            SetError("[odbc] Error turning off autocommit on the connection\0");
+            return;
+          }
+          own_transaction = true;
+        }
+      }
+
+      bool inserted = InsertBatches();
+
+      if (own_transaction) {
+        // keep the errors of the insert, not the ones of ending the transaction
+        return_code =
+        SQLEndTran
+        (
+          SQL_HANDLE_DBC,                       // HandleType
+          odbcConnectionObject->hDBC,           // Handle
+          inserted ? SQL_COMMIT : SQL_ROLLBACK  // CompletionType
+        );
+        bool ended = SQL_SUCCEEDED(return_code);
+        if (!ended && inserted) {
+          this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+          SetError("[odbc] Error committing the inserted columns\0");
+          inserted = false;
+        }
+        if (!inserted) {
+          inserted_count = 0;
+        }
+
+        // Turning autocommit on would commit a transaction that couldn't be
+        // ended, rows of a failed insert included, so it is left open
+        if (ended) {
+          return_code =
+          SQLSetConnectAttr
+          (
+            odbcConnectionObject->hDBC,     // ConnectionHandle
+            SQL_ATTR_AUTOCOMMIT,            // Attribute
+            (SQLPOINTER) SQL_AUTOCOMMIT_ON, // ValuePtr
+            SQL_NTS                         // StringLength
+          );
+          if (!SQL_SUCCEEDED(return_code) && inserted) {
+            this->errors = GetODBCErrors(SQL_HANDLE_DBC, odbcConnectionObject->hDBC);
+            SetError("[odbc] Error turning on autocommit on the connection\0");
+          }
+        }
+        // A connection left in manual-commit mode counts as having an open
+        // transaction, so that resetState (run when a Pool gets it back) rolls
+        // it back and turns autocommit on again, instead of the work of its
+        // next user never being committed
+        if (!ended || !SQL_SUCCEEDED(return_code)) {
+          odbcConnectionObject->transactionOpen = true;
+        }
+      }
+    }
+
+    // Each batch binds the parameters to the next rows of the TypedArrays and
+    // executes the statement once for all of them. Returns false (with the
+    // error set) if a batch failed.
+    bool InsertBatches() {
+
+      SQLRETURN return_code;
+      SQLULEN paramset_size = 0;
+
+      for (size_t first_row = 0; first_row < row_count; first_row += rows_per_batch) {
+        SQLULEN batch_size = (SQLULEN) std::min(rows_per_batch, row_count - first_row);
+
+        if (batch_size != paramset_size) {
+          return_code =
+          SQLSetStmtAttr
+          (
+            data->hstmt,
+            SQL_ATTR_PARAMSET_SIZE,
+            (SQLPOINTER) (uintptr_t) batch_size,
+            IGNORED_PARAMETER
+          );
+          if (!SQL_SUCCEEDED(return_code)) {
+            this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+            SetError("[odbc] Error setting the number of rows to insert on the statement\0");
+            return false;
+          }
+          paramset_size = batch_size;
+        }
+
+        for (size_t i = 0; i < columns.size(); i++) {
+          InsertColumn *column = &columns[i];
+          // fixed-length C types need no length/indicator array
+          return_code =
+          SQLBindParameter
+          (
+            data->hstmt,                                  // StatementHandle
+            (SQLUSMALLINT) (i + 1),                       // ParameterNumber
+            SQL_PARAM_INPUT,                              // InputOutputType
+            column->ValueType,                            // ValueType
+            column->ParameterType,                        // ParameterType
+            0,                                            // ColumnSize
+            0,                                            // DecimalDigits
+            column->data + first_row * column->element_size, // ParameterValuePtr
+            (SQLLEN) column->element_size,                // BufferLength
+            NULL                                          // StrLen_or_IndPtr
+          );
+          if (!SQL_SUCCEEDED(return_code)) {
+            this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+            SetError("[odbc] Error binding the columns to insert\0");
+            return false;
+          }
+        }
+
+        return_code = SQLExecute(data->hstmt);
+        if (!SQL_SUCCEEDED(return_code) && return_code != SQL_NO_DATA) {
+          this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+          SetError("[odbc] Error inserting the columns\0");
+          return false;
+        }
+
+        SQLLEN batch_count = 0;
+        return_code = SQLRowCount(data->hstmt, &batch_count);
+        if (SQL_SUCCEEDED(return_code) && batch_count > 0) {
+          inserted_count += batch_count;
+        }
+      }
+      return true;
+    }
+
+    void OnOK() {
+
+      Napi::Env env = Env();
+      Napi::HandleScope scope(env);
+
+      std::vector<napi_value> callbackArguments =
+      {
+        env.Null(),
+        Napi::Number::New(env, (double) inserted_count)
+      };
+
+      Callback().Call(callbackArguments);
+    }
+
+  public:
+    InsertColumnsAsyncWorker
+    (
+      ODBCConnection            *odbcConnectionObject,
+      Napi::Array                napiColumnArray,
+      StatementData             *data,
+      std::vector<InsertColumn>  columns,
+      size_t                     row_count,
+      size_t                     rows_per_batch,
+      Napi::Function&            callback
+    )
+    :
+    ODBCAsyncWorker(callback),
+    odbcConnectionObject(odbcConnectionObject),
+    data(data),
+    columns(columns),
+    row_count(row_count),
+    rows_per_batch(rows_per_batch)
+    {
+      // keeps the TypedArrays, and so the bound memory, alive until the
+      // worker is done
+      napiColumns = Napi::Persistent(napiColumnArray);
+    }
+
+    ~InsertColumnsAsyncWorker() {
+      uv_mutex_lock(&ODBC::g_odbcMutex);
+      // It is possible the connection handle has been freed, which freed the
+      // statement handle as well. Freeing again would cause a segfault.
+      if (this->odbcConnectionObject->hDBC != SQL_NULL_HANDLE && this->data->hstmt != SQL_NULL_HANDLE) {
+        SQLFreeHandle
+        (
+          SQL_HANDLE_STMT,
+          this->data->hstmt
+        );
+      }
+      this->data->hstmt = SQL_NULL_HANDLE;
+      uv_mutex_unlock(&ODBC::g_odbcMutex);
+      delete data;
+      data = NULL;
+      napiColumns.Reset();
+    }
+};
+
+/*
+ *  ODBCConnection::InsertColumns
+ *
+ *    Description: Inserts rows from columns of values held in TypedArrays,
+ *                 binding the memory of each TypedArray as an array of
+ *                 parameters and inserting as many rows per execution as fit
+ *                 in the memory budget.
+ *
+ *    Parameters:
+ *      const Napi::CallbackInfo& info:
+ *        The information passed from the JavaSript environment, including the
+ *        function arguments for 'insertColumns'.
+ *
+ *        info[0]: String: the INSERT statement, with a parameter marker for
+ *                 each column
+ *        info[1]: Array: the TypedArrays holding the values of each column,
+ *                 all of the same length
+ *        info[2]: Number: the number of bytes of values to insert with each
+ *                 execution, or null/undefined for the default
+ *        info[3]: Function: callback function:
+ *            function(error, result)
+ *              error: An error object if the insert failed, or null if
+ *                     operation was successful.
+ *              result: The number of rows inserted.
+ *
+ *    Return:
+ *      Napi::Value:
+ *        Undefined (results returned in callback)
+ */
+Napi::Value ODBCConnection::InsertColumns(const Napi::CallbackInfo& info) {
+
+  Napi::Env env = info.Env();
+  Napi::HandleScope scope(env);
+
+  if
+  (
+    info.Length() != 4  ||
+    !info[0].IsString() ||
+    !info[1].IsArray()  ||
+    !(
+      info[2].IsNumber() ||
+      info[2].IsNull()   ||
+      info[2].IsUndefined()
+    ) ||
+    !info[3].IsFunction()
+  )
+  {
+    Napi::TypeError::New(env, "[node-odbc]: Wrong function signature in call to Connection.insertColumns({string}, {array}, {number}[optional], {function}).").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  Napi::Array    napiColumnArray = info[1].As<Napi::Array>();
+  Napi::Function callback        = info[3].As<Napi::Function>();
+
+  std::vector<InsertColumn> columns(napiColumnArray.Length());
+  size_t row_count = 0;
+  size_t row_size  = 0;
+
+  for (uint32_t i = 0; i < napiColumnArray.Length(); i++) {
+
+    Napi::Value value = napiColumnArray.Get(i);
+    if (!value.IsTypedArray()) {
+      Napi::TypeError::New(env, "[node-odbc]: Columns passed to Connection.insertColumns must be TypedArrays.").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+
+    napi_typedarray_type type;
+    size_t               length;
+    void                *typed_array_data;
+    napi_get_typedarray_info(env, value, &type, &length, &typed_array_data, NULL, NULL);
+
+    InsertColumn *column = &columns[i];
+    column->data = (SQLCHAR *) typed_array_data;
+
+    switch (type) {
+      case napi_int8_array:
+        column->ValueType     = SQL_C_STINYINT;
+        column->ParameterType = SQL_SMALLINT;
+        column->element_size  = sizeof(SQLSCHAR);
+        break;
+      case napi_uint8_array:
+      case napi_uint8_clamped_array:
+        column->ValueType     = SQL_C_UTINYINT;
+        column->ParameterType = SQL_SMALLINT;
+        column->element_size  = sizeof(SQLCHAR);
+        break;
+      case napi_int16_array:
+        column->ValueType     = SQL_C_SSHORT;
+        column->ParameterType = SQL_SMALLINT;
+        column->element_size  = sizeof(SQLSMALLINT);
+        break;
+      case napi_uint16_array:
+        column->ValueType     = SQL_C_USHORT;
+        column->ParameterType = SQL_INTEGER;
+        column->element_size  = sizeof(SQLUSMALLINT);
+        break;
+      case napi_int32_array:
+        column->ValueType     = SQL_C_SLONG;
+        column->ParameterType = SQL_INTEGER;
+        column->element_size  = sizeof(SQLINTEGER);
+        break;
+      case napi_uint32_array:
+        column->ValueType     = SQL_C_ULONG;
+        column->ParameterType = SQL_BIGINT;
+        column->element_size  = sizeof(SQLUINTEGER);
+        break;
+      case napi_float32_array:
+        column->ValueType     = SQL_C_FLOAT;
+        column->ParameterType = SQL_REAL;
+        column->element_size  = sizeof(SQLREAL);
+        break;
+      case napi_float64_array:
+        column->ValueType     = SQL_C_DOUBLE;
+        column->ParameterType = SQL_DOUBLE;
+        column->element_size  = sizeof(SQLDOUBLE);
+        break;
+      case napi_bigint64_array:
+        column->ValueType     = SQL_C_SBIGINT;
+        column->ParameterType = SQL_BIGINT;
+        column->element_size  = sizeof(SQLBIGINT);
+        break;
+      case napi_biguint64_array:
+        column->ValueType     = SQL_C_UBIGINT;
+        column->ParameterType = SQL_BIGINT;
+        column->element_size  = sizeof(SQLUBIGINT);
+        break;
+      default:
+        Napi::TypeError::New(env, "[node-odbc]: Unsupported TypedArray type passed to Connection.insertColumns.").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    if (i == 0) {
+      row_count = length;
+    } else if (length != row_count) {
+      Napi::TypeError::New(env, "[node-odbc]: Columns passed to Connection.insertColumns must all have the same length.").ThrowAsJavaScriptException();
+      return env.Null();
+    }
 
-      // check for null data
-      if (parameter->StrLen_or_IndPtr == SQL_NULL_DATA) {
-        value = env.Null();
-      } else {
-        // Create a JavaScript value based on the C type that was bound to
-        switch(parameter->ValueType) {
-          case SQL_C_DOUBLE:
-            value = Napi::Number::New(env, *(double*)parameter->ParameterValuePtr);
-            break;
-          case SQL_C_SLONG:
-            value = Napi::Number::New(env, *(SQLINTEGER*)parameter->ParameterValuePtr);
-            break;
-          case SQL_C_ULONG:
-            value = Napi::Number::New(env, *(SQLUINTEGER*)parameter->ParameterValuePtr);
-            break;
-          // Napi::BigInt
-          case SQL_C_SBIGINT:
-            if (parameter->isbigint ==  true) {
-              value = Napi::BigInt::New(env, *(int64_t*)parameter->ParameterValuePtr);
-            } else {
-              value = Napi::Number::New(env, *(int64_t*)parameter->ParameterValuePtr);
-            }
-            break;
-          case SQL_C_UBIGINT:
-            if (parameter->isbigint ==  true) {
-              value = Napi::BigInt::New(env, *(uint64_t*)parameter->ParameterValuePtr);
-            } else {
-              value = Napi::Number::New(env, *(uint64_t*)parameter->ParameterValuePtr);
-            }
-            break;
-          case SQL_C_SSHORT:
-            value = Napi::Number::New(env, *(signed short*)parameter->ParameterValuePtr);
-            break;
-          case SQL_C_USHORT:
-            value = Napi::Number::New(env, *(unsigned short*)parameter->ParameterValuePtr);
-            break;
-          // Napi::ArrayBuffer
-          case SQL_C_BINARY:
-            // value = Napi::Buffer<SQLCHAR>::New(env, (SQLCHAR*)parameter->ParameterValuePtr, *parameter->StrLen_or_IndPtr);
-            value = Napi::Buffer<SQLCHAR>::Copy(env, (SQLCHAR*)parameter->ParameterValuePtr, parameter->StrLen_or_IndPtr);
-            break;
-          // Napi::String (char16_t)
-          case SQL_C_WCHAR:
-            value = Napi::String::New(env, (const char16_t*)parameter->ParameterValuePtr, parameter->StrLen_or_IndPtr/sizeof(SQLWCHAR));
-            break;
-          // Napi::String (char)
-          case SQL_C_CHAR:
-          default:
-            value = Napi::String::New(env, (const char*)parameter->ParameterValuePtr);
-            break;
-        }
-      }
-      napiArray.Set(i, value);
-    } 
+    row_size += column->element_size;
   }
-}
 
+  size_t batch_memory = INSERT_COLUMNS_BATCH_MEMORY;
+  if (info[2].IsNumber() && info[2].As<Napi::Number>().Int64Value() > 0) {
+    batch_memory = (size_t) info[2].As<Napi::Number>().Int64Value();
+  }
+  size_t rows_per_batch = row_size > 0 ? std::max(batch_memory / row_size, (size_t) 1) : 1;
+
+  StatementData *data = new StatementData();
+  data->henv = this->hENV;
+  data->hdbc = this->hDBC;
+  data->sql  = ODBC::NapiStringToSQLTCHAR(info[0].ToString());
+
+  InsertColumnsAsyncWorker *worker = new InsertColumnsAsyncWorker(this, napiColumnArray, data, columns, row_count, rows_per_batch, callback);
+  worker->Queue();
+
+  return env.Undefined();
+}
 
 /******************************************************************************
  ***************************** CALL PROCEDURE *********************************
@@ -2001,6 +3058,8 @@ Napi::Value ODBCConnection::CallProcedure(const Napi::CallbackInfo& info) {
     for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
       data->parameters[i] = new Parameter();
     }
+    // No arena: the buffers of input/output procedure parameters are replaced
+    // with larger ones once the procedure's parameters have been described
     ODBC::StoreBindValues(&napiArray, data->parameters);
   } else if ((info.Length() == 4 && info[4].IsFunction()) || (info.Length() == 5 && info[3].IsNull() && info[4].IsFunction())) {
     data->parameters = 0;
@@ -2917,6 +3976,7 @@ class BeginTransactionAsyncWorker : public ODBCAsyncWorker {
         SetError("[odbc] Error turning off autocommit on the connection\0");
         return;
       }
+      odbcConnectionObject->transactionOpen = true;
     }
 
     void OnOK() {
@@ -3012,6 +4072,7 @@ class EndTransactionAsyncWorker : public ODBCAsyncWorker {
         SetError("[odbc] Error turning on autocommit on the connection\0");
         return;
       }
+      odbcConnectionObject->transactionOpen = false;
     }
 
     void OnOK() {
@@ -3149,6 +4210,223 @@ prepare_for_fetch
 }
 
 
+// Alignment of the C types that columns are bound to, used to lay out the
+// columns when binding row-wise.
+static size_t
+bind_type_alignment
+(
+  SQLSMALLINT bind_type
+)
+{
+  switch (bind_type)
+  {
+    case SQL_C_DOUBLE:
+      return alignof(SQLDOUBLE);
+    case SQL_C_SBIGINT:
+      return alignof(SQLBIGINT);
+    case SQL_C_SLONG:
+      return alignof(SQLINTEGER);
+    case SQL_C_SHORT:
+      return alignof(SQLSMALLINT);
+    case SQL_C_WCHAR:
+      return alignof(SQLWCHAR);
+    default:
+      return alignof(SQLCHAR);
+  }
+}
+
+static size_t
+align_offset
+(
+  size_t offset,
+  size_t alignment
+)
+{
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+// Binds all of the non-LONG columns row-wise: each row of the rowset is one
+// block of data->row_size bytes that holds every column's StrLen_or_Ind value
+// followed by every column's data, so that converting a row walks memory
+// sequentially instead of visiting a separate buffer for each column. Data is
+// ordered by decreasing alignment so that every field is naturally aligned
+// without padding between them.
+static SQLRETURN
+bind_buffers_row_wise
+(
+  StatementData *data
+)
+{
+  SQLRETURN return_code = SQL_SUCCESS;
+  size_t    row_alignment = std::max({ alignof(SQLLEN), alignof(SQLDOUBLE), alignof(SQLBIGINT) });
+  size_t    offset = 0;
+
+  for (int i = 0; i < data->column_count; i++)
+  {
+    if (!data->columns[i]->is_long_data)
+    {
+      data->columns[i]->indicator_offset = offset;
+      offset += sizeof(SQLLEN);
+    }
+  }
+
+  for (size_t alignment = row_alignment; alignment > 0; alignment /= 2)
+  {
+    for (int i = 0; i < data->column_count; i++)
+    {
+      Column *column = data->columns[i];
+      if (column->is_long_data || bind_type_alignment(column->bind_type) != alignment)
+      {
+        continue;
+      }
+      offset = align_offset(offset, alignment);
+      column->data_offset = offset;
+      offset += column->buffer_size;
+    }
+  }
+
+  // Every column is retrieved with SQLGetData, nothing to bind
+  if (offset == 0)
+  {
+    return return_code;
+  }
+
+  data->row_size   = align_offset(offset, row_alignment);
+  data->row_buffer = new SQLCHAR[data->row_size * data->fetch_size]();
+
+  return_code =
+  SQLSetStmtAttr
+  (
+    data->hstmt,
+    SQL_ATTR_ROW_BIND_TYPE,
+    (SQLPOINTER) data->row_size,
+    IGNORED_PARAMETER
+  );
+
+  if (!SQL_SUCCEEDED(return_code))
+  {
+    return return_code;
+  }
+
+  for (int i = 0; i < data->column_count; i++)
+  {
+    Column *column = data->columns[i];
+    if (column->is_long_data)
+    {
+      continue;
+    }
+
+    data->bound_columns[i].buffer =
+      data->row_buffer + column->data_offset;
+    data->bound_columns[i].length_or_indicator_array =
+      (SQLLEN *)(data->row_buffer + column->indicator_offset);
+
+    return_code =
+    SQLBindCol
+    (
+      data->hstmt,                                       // StatementHandle
+      i + 1,                                             // ColumnNumber
+      column->bind_type,                                 // TargetType
+      data->bound_columns[i].buffer,                     // TargetValuePtr
+      column->buffer_size,                               // BufferLength
+      data->bound_columns[i].length_or_indicator_array   // StrLen_or_Ind
+    );
+
+    if (!SQL_SUCCEEDED(return_code))
+    {
+      return return_code;
+    }
+  }
+
+  return return_code;
+}
+
+// Returns a pointer to the bound data of a column for a row of the rowset.
+// When bound column-wise, rows are buffer_size bytes apart; when bound
+// row-wise, they are row_size bytes apart.
+static inline SQLCHAR*
+bound_data
+(
+  StatementData *data,
+  int            column_index,
+  size_t         row_index
+)
+{
+  size_t stride =
+    data->row_size > 0 ? data->row_size : data->columns[column_index]->buffer_size;
+  return (SQLCHAR *)data->bound_columns[column_index].buffer + (row_index * stride);
+}
+
+static inline SQLLEN
+bound_length_or_indicator
+(
+  StatementData *data,
+  int            column_index,
+  size_t         row_index
+)
+{
+  if (data->row_size > 0)
+  {
+    return *(SQLLEN *)((SQLCHAR *)data->bound_columns[column_index].length_or_indicator_array + (row_index * data->row_size));
+  }
+  return data->bound_columns[column_index].length_or_indicator_array[row_index];
+}
+
+// Returns the number of bytes of data in a bound cell, not counting the null
+// terminator of character data. This is normally the StrLen_or_Ind value the
+// driver filled in, which saves scanning the buffer and keeps any embedded
+// null characters. If the driver returned SQL_NO_TOTAL or the data was
+// truncated to fit the buffer, all that is available is what the buffer
+// holds: binary data fills it, and character data has to be scanned for its
+// null terminator.
+static inline SQLLEN
+bound_data_size
+(
+  StatementData *data,
+  int            column_index,
+  size_t         row_index
+)
+{
+  Column *column              = data->columns[column_index];
+  SQLLEN  length_or_indicator = bound_length_or_indicator(data, column_index, row_index);
+  SQLLEN  capacity;
+
+  switch (column->bind_type)
+  {
+    case SQL_C_WCHAR:
+      capacity = column->buffer_size - sizeof(SQLWCHAR);
+      break;
+    case SQL_C_BINARY:
+      capacity = column->buffer_size;
+      break;
+    case SQL_C_CHAR:
+    default:
+      capacity = column->buffer_size - sizeof(SQLCHAR);
+      break;
+  }
+
+  if (length_or_indicator >= 0 && length_or_indicator <= capacity)
+  {
+    return length_or_indicator;
+  }
+
+  SQLCHAR *cell = bound_data(data, column_index, row_index);
+
+  switch (column->bind_type)
+  {
+    case SQL_C_WCHAR:
+      return strnlen16((const char16_t *)cell, capacity / sizeof(SQLWCHAR)) * sizeof(SQLWCHAR);
+    case SQL_C_BINARY:
+      return capacity;
+    case SQL_C_CHAR:
+    default:
+    {
+      const void *terminator = memchr(cell, '\0', capacity);
+      return terminator == NULL ? capacity : (SQLCHAR *)terminator - cell;
+    }
+  }
+}
+
 SQLRETURN
 bind_buffers
 (
@@ -3169,6 +4447,10 @@ bind_buffers
     return return_code;
   }
 
+  // Create Columns for the column data to go into
+  data->columns       = new Column*[data->column_count]();
+  data->bound_columns = new ColumnBuffer[data->column_count]();
+
   return_code =
   SQLSetStmtAttr
   (
@@ -3227,10 +4509,6 @@ bind_buffers
   }
   else
   {
-    // Create Columns for the column data to go into
-    data->columns       = new Column*[data->column_count]();
-    data->bound_columns = new ColumnBuffer[data->column_count]();
-
     return_code =
     SQLSetStmtAttr
     (
@@ -3283,15 +4561,17 @@ bind_buffers
     }
   }
 
+  // Row-wise binding needs every column described before any of them can be
+  // bound, since the size of a row depends on all of the bound columns. It
+  // can only be used if the driver accepted SQL_ATTR_ROW_BIND_TYPE above.
+  bool bind_row_wise =
+    data->query_options.row_binding && !data->simple_binding;
+
   for (int i = 0; i < data->column_count; i++)
   {
     Column *column = new Column();
     column->ColumnName = new SQLTCHAR[data->maxColumnNameLength + 1]();
-
-    // TODO: Could just allocate one large SQLLEN buffer that was of size
-    // column_count * fetch_size, then just do the pointer arithmetic for it..
-    data->bound_columns[i].length_or_indicator_array =
-      new SQLLEN[data->fetch_size]();
+    data->columns[i] = column;
 
     return_code = 
     SQLDescribeCol
@@ -3349,8 +4629,6 @@ bind_buffers
         } else {
           size_t character_count = column->ColumnSize + 1;
           column->buffer_size = character_count * sizeof(SQLWCHAR);
-          data->bound_columns[i].buffer =
-            new SQLWCHAR[character_count * data->fetch_size]();
         }
         break;
       case SQL_LONGVARCHAR:
@@ -3361,8 +4639,6 @@ bind_buffers
         } else {
           size_t character_count = column->ColumnSize * MAX_UTF8_BYTES + 1;
           column->buffer_size = character_count * sizeof(SQLCHAR);
-          data->bound_columns[i].buffer =
-            new SQLCHAR[character_count * data->fetch_size]();
         }
         break;
       case SQL_LONGVARBINARY:
@@ -3372,7 +4648,6 @@ bind_buffers
           column->is_long_data = true;
         } else {
           column->buffer_size = (column->ColumnSize) * sizeof(SQLCHAR);
-          data->bound_columns[i].buffer = new SQLCHAR[column->buffer_size]();
         }
         break;
 
@@ -3383,8 +4658,6 @@ bind_buffers
         size_t character_count = column->ColumnSize + 2;
         column->buffer_size = character_count * sizeof(SQLCHAR);
         column->bind_type = SQL_C_CHAR;
-        data->bound_columns[i].buffer =
-          new SQLCHAR[character_count * data->fetch_size]();
         break;
       }
 
@@ -3393,8 +4666,6 @@ bind_buffers
       {
         column->buffer_size = sizeof(SQLDOUBLE);
         column->bind_type = SQL_C_DOUBLE;
-        data->bound_columns[i].buffer =
-          new SQLDOUBLE[data->fetch_size]();
         break;
       }
 
@@ -3402,8 +4673,6 @@ bind_buffers
       {
         column->buffer_size = sizeof(SQLCHAR);
         column->bind_type = SQL_C_UTINYINT;
-        data->bound_columns[i].buffer =
-          new SQLCHAR[data->fetch_size]();
         break;
       }
 
@@ -3411,8 +4680,6 @@ bind_buffers
       {
         column->buffer_size = sizeof(SQLSMALLINT);
         column->bind_type = SQL_C_SHORT;
-        data->bound_columns[i].buffer =
-          new SQLSMALLINT[data->fetch_size]();
         break;
       }
 
@@ -3420,8 +4687,6 @@ bind_buffers
       {
         column->buffer_size = sizeof(SQLINTEGER);
         column->bind_type = SQL_C_SLONG;
-        data->bound_columns[i].buffer =
-          new SQLINTEGER[data->fetch_size]();
         break;
       }
 
@@ -3429,8 +4694,6 @@ bind_buffers
       {
         column->buffer_size = sizeof(SQLBIGINT);
         column->bind_type = SQL_C_SBIGINT;
-        data->bound_columns[i].buffer =
-          new SQLBIGINT[data->fetch_size]();
         break;
       }
 
@@ -3445,8 +4708,6 @@ bind_buffers
           break;
         }
         column->buffer_size = column->ColumnSize;
-        data->bound_columns[i].buffer =
-          new SQLCHAR[column->buffer_size * data->fetch_size]();
         break;
       }
 
@@ -3462,8 +4723,6 @@ bind_buffers
         }
         size_t character_count = column->ColumnSize + 1;
         column->buffer_size = character_count * sizeof(SQLWCHAR);
-        data->bound_columns[i].buffer =
-          new SQLWCHAR[character_count * data->fetch_size]();
         break;
       }
 
@@ -3480,14 +4739,17 @@ bind_buffers
         }
         size_t character_count = column->ColumnSize * MAX_UTF8_BYTES + 1;
         column->buffer_size = character_count * sizeof(SQLCHAR);
-        data->bound_columns[i].buffer =
-          new SQLCHAR[character_count * data->fetch_size]();
         break;
       }
     }
 
-    if (!column->is_long_data)
+    if (!column->is_long_data && !bind_row_wise)
     {
+      data->bound_columns[i].buffer =
+        new SQLCHAR[column->buffer_size * data->fetch_size]();
+      data->bound_columns[i].length_or_indicator_array =
+        new SQLLEN[data->fetch_size]();
+
       // SQLBindCol binds application data buffers to columns in the result set.
       return_code =
       SQLBindCol
@@ -3504,8 +4766,13 @@ bind_buffers
         return return_code;
       }
     }
-    data->columns[i] = column;
   }
+
+  if (bind_row_wise)
+  {
+    return_code = bind_buffers_row_wise(data);
+  }
+
   return return_code;
 }
 
@@ -3816,7 +5083,7 @@ fetch_and_store
             // support block cursors + SQLGetData.
             else
             {
-              if (data->bound_columns[column_index].length_or_indicator_array[row_index] == SQL_NULL_DATA) {
+              if (bound_length_or_indicator(data, column_index, row_index) == SQL_NULL_DATA) {
                 row[column_index].size = SQL_NULL_DATA;
               }
               else
@@ -3825,42 +5092,42 @@ fetch_and_store
                 {
                   case SQL_C_DOUBLE:
                     row[column_index].double_data =
-                      ((SQLDOUBLE *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLDOUBLE *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_UTINYINT:
                     row[column_index].tinyint_data =
-                      ((SQLCHAR *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLCHAR *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_SSHORT:
                   case SQL_C_SHORT:
                     row[column_index].smallint_data =
-                      ((SQLSMALLINT *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLSMALLINT *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_USHORT:
                     row[column_index].usmallint_data =
-                      ((SQLUSMALLINT *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLUSMALLINT *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_SLONG:
                     row[column_index].integer_data =
-                      ((SQLINTEGER *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLINTEGER *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_SBIGINT:
                     row[column_index].bigint_data =
-                      ((SQLBIGINT *)(data->bound_columns[column_index].buffer))[row_index];
+                      *(SQLBIGINT *)bound_data(data, column_index, row_index);
                     break;
 
                   case SQL_C_BINARY:
                   {
-                    row[column_index].size = data->bound_columns[column_index].length_or_indicator_array[row_index];
+                    row[column_index].size = bound_data_size(data, column_index, row_index);
                     row[column_index].char_data = new SQLCHAR[row[column_index].size]();
                     memcpy(
                       row[column_index].char_data,
-                      (SQLCHAR *)data->bound_columns[column_index].buffer + row_index * data->columns[column_index]->buffer_size,
+                      bound_data(data, column_index, row_index),
                       row[column_index].size
                     );
                     break;
@@ -3868,8 +5135,8 @@ fetch_and_store
 
                   case SQL_C_WCHAR:
                   {
-                    SQLWCHAR *memory_start = (SQLWCHAR *)data->bound_columns[column_index].buffer + (row_index * (data->columns[column_index]->ColumnSize + 1));
-                    row[column_index].size = strlen16((const char16_t *)memory_start) * sizeof(SQLWCHAR);
+                    SQLWCHAR *memory_start = (SQLWCHAR *)bound_data(data, column_index, row_index);
+                    row[column_index].size = bound_data_size(data, column_index, row_index);
                     row[column_index].wchar_data = new SQLWCHAR[(row[column_index].size / sizeof(SQLWCHAR)) + 1]();
                     memcpy
                     (
@@ -3883,8 +5150,8 @@ fetch_and_store
                   case SQL_C_CHAR:
                   default:
                   {
-                    SQLCHAR *memory_start = (SQLCHAR *)data->bound_columns[column_index].buffer + (row_index * data->columns[column_index]->buffer_size);
-                    row[column_index].size = strlen((const char *)memory_start);
+                    SQLCHAR *memory_start = bound_data(data, column_index, row_index);
+                    row[column_index].size = bound_data_size(data, column_index, row_index);
                     // Although fields going from SQL_C_CHAR to Napi::String use
                     // row[column_index].size, NUMERIC data uses atof() which requires
                     // a null terminator. Need to add an aditional byte.
@@ -4044,10 +5311,142 @@ get_odbc_type_name
   }
 }
 
+// Column metadata copied off of the StatementData, so that the 'columns'
+// property on the result array can be built lazily the first time it is read,
+// long after the StatementData (and its Column structures) have been freed.
+typedef struct ColumnDescription {
+#ifdef UNICODE
+  std::u16string name;
+#else
+  std::string    name;
+#endif
+  SQLSMALLINT    data_type;
+  SQLULEN        column_size;
+  SQLSMALLINT    decimal_digits;
+  SQLSMALLINT    nullable;
+} ColumnDescription;
+
+// Checks whether character data is entirely 7-bit ASCII. Blocks of 32 bytes
+// are OR-ed together a word at a time without branching, which compilers can
+// turn into vector instructions, before testing the high bit of every byte.
+static inline bool
+is_ascii
+(
+  const SQLCHAR *char_data,
+  size_t         size
+)
+{
+  const uint64_t high_bits = 0x8080808080808080ULL;
+  size_t index = 0;
+
+  for (; index + 32 <= size; index += 32)
+  {
+    uint64_t words[4];
+    memcpy(words, char_data + index, sizeof(words));
+    if ((words[0] | words[1] | words[2] | words[3]) & high_bits)
+    {
+      return false;
+    }
+  }
+
+  for (; index < size; index++)
+  {
+    if (char_data[index] & 0x80)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Creates a JavaScript string from SQL_C_CHAR data. ASCII is the same in
+// UTF-8 and in Latin-1, so ASCII data, along with data from columns the user
+// declared as Latin-1, is copied straight into a one-byte string instead of
+// going through UTF-8 decoding.
+static Napi::Value
+char_data_to_napi_string
+(
+  Napi::Env      env,
+  const SQLCHAR *char_data,
+  size_t         size,
+  bool           is_latin1
+)
+{
+  if (is_latin1 || is_ascii(char_data, size))
+  {
+    napi_value string;
+    napi_status status =
+      napi_create_string_latin1(env, (const char *)char_data, size, &string);
+    if (status == napi_ok)
+    {
+      return Napi::Value(env, string);
+    }
+  }
+  return Napi::String::New(env, (const char *)char_data, size);
+}
+
+// With the intern query option, each character column keeps the JavaScript
+// strings it has created, keyed by the bytes of the value, so that repeated
+// values share one string. The keys point into the stored rows, which live
+// until the conversion is done. Only short values are interned, each column
+// keeps a bounded number of them, and a column stops interning if the first
+// rows sampled show that its values don't repeat much.
+typedef std::unordered_map<std::string_view, napi_value> InternedStrings;
+
+static const size_t INTERN_MAX_VALUE_SIZE = 64;
+static const size_t INTERN_MAX_VALUES     = 4096;
+static const size_t INTERN_SAMPLE_ROWS    = 64;
+
+// Creates a JavaScript string from a SQL_C_CHAR or SQL_C_WCHAR cell, reusing
+// an interned string if one was already created for the same value.
+static Napi::Value
+string_data_to_napi
+(
+  Napi::Env        env,
+  ColumnData      *cell,
+  bool             is_latin1,
+  InternedStrings *interned_strings
+)
+{
+  std::string_view key;
+
+  if (interned_strings != NULL && (size_t)cell->size <= INTERN_MAX_VALUE_SIZE)
+  {
+    key = std::string_view((const char *)cell->char_data, cell->size);
+    InternedStrings::iterator interned = interned_strings->find(key);
+    if (interned != interned_strings->end())
+    {
+      return Napi::Value(env, interned->second);
+    }
+  }
+  else
+  {
+    interned_strings = NULL;
+  }
+
+  Napi::Value value;
+  if (cell->bind_type == SQL_C_WCHAR)
+  {
+    value = Napi::String::New(env, (const char16_t*)cell->wchar_data, cell->size / sizeof(SQLWCHAR));
+  }
+  else
+  {
+    value = char_data_to_napi_string(env, cell->char_data, cell->size, is_latin1);
+  }
+
+  if (interned_strings != NULL && interned_strings->size() < INTERN_MAX_VALUES)
+  {
+    interned_strings->emplace(key, value);
+  }
+
+  return value;
+}
+
 // All of data has been loaded into data->storedRows. Have to take the data
 // stored in there and convert it it into JavaScript to be given to the
 // Node.js runtime.
-Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Array napiParameters) {
+Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Value napiParameters) {
 
   Column **columns = data->columns;
   SQLSMALLINT columnCount = data->column_count;
@@ -4056,7 +5455,7 @@ Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Arra
   // This array holds the records that were returned from the query as objects,
   // with the column names as the property keys on the object and the table
   // values as the property values.
-  // Additionally, there are four properties that are added directly onto the
+  // Additionally, there are five properties that are added directly onto the
   // array:
   //   'count'   : The  returned from SQLRowCount, which returns "the
   //               number of rows affected by an UPDATE, INSERT, or DELETE
@@ -4076,57 +5475,106 @@ Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Arra
   //   'statement'  : The SQL statement that was sent to the server. Parameter
   //                  markers are not altered, but parameters passed can be
   //                  determined from the parameters array on this object
-  Napi::Array rows = Napi::Array::New(env);
-
-  // set the 'statement' property
+  //
+  // The array is allocated with its final length, and the properties above
+  // are defined as non-enumerable in a single call, so that V8 keeps the array
+  // on its fast elements path instead of growing it one element at a time.
+  // 'columns' is an accessor that only builds its array of objects when it is
+  // first read, and then replaces itself with the built value.
+  Napi::Array rows = Napi::Array::New(env, data->storedRows.size());
+
+  napi_property_attributes metadata_attributes =
+    (napi_property_attributes)(napi_writable | napi_configurable);
+
+  Napi::Value statement;
   if (data->sql == NULL) {
-    rows.Set(Napi::String::New(env, STATEMENT), env.Null());
+    statement = env.Null();
   } else {
     #ifdef UNICODE
-    rows.Set(Napi::String::New(env, STATEMENT), Napi::String::New(env, (const char16_t*)data->sql));
+    statement = Napi::String::New(env, (const char16_t*)data->sql);
     #else
-    rows.Set(Napi::String::New(env, STATEMENT), Napi::String::New(env, (const char*)data->sql));
+    statement = Napi::String::New(env, (const char*)data->sql);
     #endif
   }
 
-  // set the 'parameters' property
-  if (napiParameters.IsEmpty()) {
-    rows.Set(Napi::String::New(env, PARAMETERS), env.Undefined());
-  } else {
-    rows.Set(Napi::String::New(env, PARAMETERS), napiParameters);
-  }
-
-  // set the 'return' property
-  rows.Set(Napi::String::New(env, RETURN), env.Undefined()); // TODO: This doesn't exist on my DBMS of choice, need to test on MSSQL Server or similar
-
-  // set the 'count' property
-  rows.Set(Napi::String::New(env, COUNT), Napi::Number::New(env, (double)data->rowCount));
-
-  // construct the array for the 'columns' property and then set
-  Napi::Array napiColumns = Napi::Array::New(env);
+  std::shared_ptr<std::vector<ColumnDescription>> column_descriptions =
+    std::make_shared<std::vector<ColumnDescription>>(columnCount);
 
   for (SQLSMALLINT h = 0; h < columnCount; h++) {
-    Napi::Object column = Napi::Object::New(env);
+    ColumnDescription &description = (*column_descriptions)[h];
     #ifdef UNICODE
-    column.Set(Napi::String::New(env, NAME), Napi::String::New(env, (const char16_t*)columns[h]->ColumnName));
+    description.name = (const char16_t*)columns[h]->ColumnName;
     #else
-    column.Set(Napi::String::New(env, NAME), Napi::String::New(env, (const char*)columns[h]->ColumnName));
+    description.name = (const char*)columns[h]->ColumnName;
     #endif
-    column.Set(Napi::String::New(env, DATA_TYPE), Napi::Number::New(env, columns[h]->DataType));
-    column.Set(Napi::String::New(env, DATA_TYPE_NAME), Napi::String::New(env, get_odbc_type_name(columns[h]->DataType)));
-    column.Set(Napi::String::New(env, COLUMN_SIZE), Napi::Number::New(env, columns[h]->ColumnSize));
-    column.Set(Napi::String::New(env, DECIMAL_DIGITS), Napi::Number::New(env, columns[h]->DecimalDigits));
-    column.Set(Napi::String::New(env, NULLABLE), Napi::Boolean::New(env, columns[h]->Nullable));
-    napiColumns.Set(h, column);
+    description.data_type      = columns[h]->DataType;
+    description.column_size    = columns[h]->ColumnSize;
+    description.decimal_digits = columns[h]->DecimalDigits;
+    description.nullable       = columns[h]->Nullable;
   }
-  rows.Set(Napi::String::New(env, COLUMNS), napiColumns);
+
+  // Columns the user declared with the latin1 query option
+  std::vector<bool> latin1_columns(columnCount, data->query_options.latin1);
+  for (size_t h = 0; h < data->query_options.latin1_columns.size(); h++) {
+    for (SQLSMALLINT k = 0; k < columnCount; k++) {
+      if ((*column_descriptions)[k].name == data->query_options.latin1_columns[h]) {
+        latin1_columns[k] = true;
+      }
+    }
+  }
+
+  // Strings already created for each column, when the intern option is set
+  std::vector<InternedStrings> interned_strings(columnCount);
+  std::vector<bool>            intern_columns(columnCount, data->query_options.intern);
+
+  rows.DefineProperties({
+    Napi::PropertyDescriptor::Value(STATEMENT, statement, metadata_attributes),
+    // 'parameters' is undefined when no parameters were passed
+    Napi::PropertyDescriptor::Value(PARAMETERS, napiParameters.IsEmpty() ? env.Undefined() : napiParameters, metadata_attributes),
+    // TODO: This doesn't exist on my DBMS of choice, need to test on MSSQL Server or similar
+    Napi::PropertyDescriptor::Value(RETURN, env.Undefined(), metadata_attributes),
+    Napi::PropertyDescriptor::Value(COUNT, Napi::Number::New(env, (double)data->rowCount), metadata_attributes),
+    Napi::PropertyDescriptor::Accessor(
+      env,
+      rows,
+      COLUMNS,
+      [column_descriptions](const Napi::CallbackInfo& info) -> Napi::Value {
+        Napi::Env env = info.Env();
+        Napi::Array napiColumns = Napi::Array::New(env, column_descriptions->size());
+
+        for (size_t h = 0; h < column_descriptions->size(); h++) {
+          const ColumnDescription &description = (*column_descriptions)[h];
+          Napi::Object column = Napi::Object::New(env);
+          column.Set(Napi::String::New(env, NAME), Napi::String::New(env, description.name));
+          column.Set(Napi::String::New(env, DATA_TYPE), Napi::Number::New(env, description.data_type));
+          column.Set(Napi::String::New(env, DATA_TYPE_NAME), Napi::String::New(env, get_odbc_type_name(description.data_type)));
+          column.Set(Napi::String::New(env, COLUMN_SIZE), Napi::Number::New(env, description.column_size));
+          column.Set(Napi::String::New(env, DECIMAL_DIGITS), Napi::Number::New(env, description.decimal_digits));
+          column.Set(Napi::String::New(env, NULLABLE), Napi::Boolean::New(env, description.nullable));
+          napiColumns.Set((uint32_t)h, column);
+        }
+
+        // Cache the built array on the result, so the accessor only runs once
+        info.This().As<Napi::Object>().DefineProperty(
+          Napi::PropertyDescriptor::Value(
+            COLUMNS,
+            napiColumns,
+            (napi_property_attributes)(napi_writable | napi_configurable)
+          )
+        );
+
+        return napiColumns;
+      },
+      napi_configurable
+    )
+  });
 
   // iterate over all of the stored rows,
   for (size_t i = 0; i < data->storedRows.size(); i++) {
     Napi::Object row;
 
     if (data->fetch_array == true) {
-      row = Napi::Array::New(env);
+      row = Napi::Array::New(env, columnCount);
     } else {
       row = Napi::Object::New(env);
     }
@@ -4217,14 +5665,14 @@ Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Arra
           case SQL_WCHAR :
           case SQL_WVARCHAR :
           case SQL_WLONGVARCHAR :
-            value = Napi::String::New(env, (const char16_t*)storedRow[j].wchar_data, storedRow[j].size / sizeof(SQLWCHAR));
+            value = string_data_to_napi(env, &storedRow[j], false, intern_columns[j] ? &interned_strings[j] : NULL);
             break;
           // Napi::String (char)
           case SQL_CHAR :
           case SQL_VARCHAR :
           case SQL_LONGVARCHAR :
           default:
-            value = Napi::String::New(env, (const char*)storedRow[j].char_data, storedRow[j].size);
+            value = string_data_to_napi(env, &storedRow[j], latin1_columns[j], intern_columns[j] ? &interned_strings[j] : NULL);
             break;
         }
       }
@@ -4239,7 +5687,17 @@ Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Arra
         #endif
       }
     }
-    rows.Set(i, row);
+    rows.Set((uint32_t)i, row);
+
+    // Stop interning columns whose sampled values are mostly distinct
+    if (data->query_options.intern && i + 1 == INTERN_SAMPLE_ROWS) {
+      for (SQLSMALLINT j = 0; j < columnCount; j++) {
+        if (interned_strings[j].size() > INTERN_SAMPLE_ROWS / 2) {
+          intern_columns[j] = false;
+          interned_strings[j].clear();
+        }
+      }
+    }
   }
 
   // Have to clear out the data in the storedRow, so that they aren't
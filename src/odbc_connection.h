@@ -20,6 +20,21 @@
 #define _SRC_ODBC_CONNECTION_H
 
 #include <napi.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define PARAMETER_DESCRIPTIONS_CACHE_SIZE 256
+#define NAMED_PARAMETERS_CACHE_SIZE 256
+// Default number of bytes of values inserted per execution by insertColumns
+#define INSERT_COLUMNS_BATCH_MEMORY 16777216
+
+// SQL written with :name parameter markers, rewritten with ? markers
+typedef struct NamedParameters {
+  std::string              sql;   // bytes of the rewritten SQLTCHAR string
+  std::vector<std::string> names; // the name of each ? marker, in order
+} NamedParameters;
 
 class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
 
@@ -36,7 +51,9 @@ class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
   friend class GetInfoAsyncWorker;
   friend class GetAttributeAsyncWorker;
   friend class CallProcedureAsyncWorker;
+  friend class InsertColumnsAsyncWorker;
   friend class SetIsolationLevelAsyncWorker;
+  friend class ResetStateAsyncWorker;
   friend class FetchAsyncWorker;
 
   friend class ODBCStatement;
@@ -62,8 +79,10 @@ class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
   // Functions exposed to the Node.js environment
   Napi::Value Close(const Napi::CallbackInfo& info);
   Napi::Value CreateStatement(const Napi::CallbackInfo& info);
+  Napi::Value Prepare(const Napi::CallbackInfo& info);
   Napi::Value Query(const Napi::CallbackInfo& info);
   Napi::Value CallProcedure(const Napi::CallbackInfo& info);
+  Napi::Value InsertColumns(const Napi::CallbackInfo& info);
 
   Napi::Value BeginTransaction(const Napi::CallbackInfo& info);
   Napi::Value Commit(const Napi::CallbackInfo &info);
@@ -80,6 +99,7 @@ class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
   Napi::Value SetConnAttr(const Napi::CallbackInfo& info);
 
   Napi::Value SetIsolationLevel(const Napi::CallbackInfo &info);
+  Napi::Value ResetState(const Napi::CallbackInfo &info);
 
   // Property Getter/Setterss
   Napi::Value ConnectedGetter(const Napi::CallbackInfo& info);
@@ -91,9 +111,19 @@ class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
 
   void ParametersToArray(Napi::Reference<Napi::Array> *napiParameters, StatementData *data, unsigned char *overwriteParameters);
 
+  SQLRETURN DescribeParameters(StatementData *data);
+  void ForgetParameterDescriptions(StatementData *data);
+  const NamedParameters* GetNamedParameters(SQLTCHAR *sql);
+
   bool isConnected;
   bool autocommit;
 
+  // Connection state changed through this object since it was opened or last
+  // reset, so that resetState only undoes what actually changed.
+  bool        transactionOpen;       // autocommit turned off by beginTransaction
+  bool        isolationLevelChanged; // set by setIsolationLevel
+  SQLUINTEGER defaultIsolationLevel; // before the first setIsolationLevel
+
   int numStatements;
 
   SQLHENV hENV;
@@ -102,9 +132,22 @@ class ODBCConnection : public Napi::ObjectWrap<ODBCConnection> {
   ConnectionOptions connectionOptions;
 
   GetInfoResults    getInfoResults;
+
+  // SQLDescribeParam results, keyed by the bytes of the SQL text, least
+  // recently used first. Used from worker threads, so access is guarded by
+  // parameterDescriptionsMutex.
+  uv_mutex_t parameterDescriptionsMutex;
+  std::list<std::pair<std::string, std::vector<ParameterDescription>>> parameterDescriptions;
+  std::unordered_map<std::string, std::list<std::pair<std::string, std::vector<ParameterDescription>>>::iterator> parameterDescriptionsIndex;
+
+  // SQL rewritten from :name to ? parameter markers, keyed by the bytes of
+  // the original SQL text, least recently used first. Only used from the
+  // main thread.
+  std::list<std::pair<std::string, NamedParameters>> namedParameters;
+  std::unordered_map<std::string, std::list<std::pair<std::string, NamedParameters>>::iterator> namedParametersIndex;
 };
 
-Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Array napiParameters);
+Napi::Array process_data_for_napi(Napi::Env env, StatementData *data, Napi::Value napiParameters);
 SQLRETURN bind_buffers(StatementData *data);
 SQLRETURN prepare_for_fetch(StatementData *data);
 SQLRETURN fetch_and_store(StatementData *data, bool set_position, bool *alloc_error);
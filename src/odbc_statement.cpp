@@ -34,6 +34,7 @@ Napi::Object ODBCStatement::Init(Napi::Env env, Napi::Object exports) {
     InstanceMethod("prepare", &ODBCStatement::Prepare),
     InstanceMethod("bind", &ODBCStatement::Bind),
     InstanceMethod("execute", &ODBCStatement::Execute),
+    InstanceMethod("run", &ODBCStatement::Run),
     InstanceMethod("close", &ODBCStatement::Close),
   });
 
@@ -140,6 +141,7 @@ class PrepareAsyncWorker : public ODBCAsyncWorker {
       for (SQLSMALLINT i = 0; i < data->parameterCount; i++) {
         data->parameters[i] = new Parameter();
       }
+      data->parameters_bound = false;
     }
 
     void OnOK() {
@@ -215,24 +217,33 @@ class BindAsyncWorker : public ODBCAsyncWorker {
 
   public:
 
-    BindAsyncWorker(ODBCStatement *odbcStatement, Napi::Function& callback) : ODBCAsyncWorker(callback),
+    BindAsyncWorker(ODBCStatement *odbcStatement, Napi::Function& callback, bool bind_parameters) : ODBCAsyncWorker(callback),
     odbcStatement(odbcStatement),
     odbcConnection(odbcStatement->odbcConnection),
-    data(odbcStatement->data) {}
+    data(odbcStatement->data),
+    bind_parameters(bind_parameters) {}
 
   private:
 
     ODBCStatement  *odbcStatement;
     ODBCConnection *odbcConnection;
     StatementData  *data;
+    bool            bind_parameters;
 
     ~BindAsyncWorker() { }
 
     void Execute() {
 
+      // the new values were written into the buffers already bound
+      if (!bind_parameters) {
+        return;
+      }
+
       SQLRETURN return_code;
 
-      return_code = ODBC::DescribeParameters(data->hstmt, data->parameters, data->parameterCount);
+      data->parameters_bound = false;
+
+      return_code = odbcConnection->DescribeParameters(data);
       if (!SQL_SUCCEEDED(return_code)) {
         this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
         SetError("[odbc] Error retrieving information about the parameters in the statement\0");
@@ -242,9 +253,12 @@ class BindAsyncWorker : public ODBCAsyncWorker {
       return_code = ODBC::BindParameters(data->hstmt, data->parameters, data->parameterCount);
       if (!SQL_SUCCEEDED(return_code)) {
         this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+        odbcConnection->ForgetParameterDescriptions(data);
         SetError("[odbc] Error binding parameters to the statement\0");
         return;
       }
+
+      data->parameters_bound = true;
     }
 
     void OnOK() {
@@ -291,10 +305,11 @@ Napi::Value ODBCStatement::Bind(const Napi::CallbackInfo& info) {
     return env.Undefined();
   }
 
-  // converts NAPI/JavaScript values to values used by SQLBindParameter
-  ODBC::StoreBindValues(&napiArray, this->data->parameters);
+  // converts NAPI/JavaScript values to values used by SQLBindParameter,
+  // writing them into the buffers bound by an earlier bind when possible
+  bool bind_parameters = ODBC::StoreBindValuesInPlace(&napiArray, this->data->parameters, this->data->parameters_bound);
 
-  BindAsyncWorker *worker = new BindAsyncWorker(this, callback);
+  BindAsyncWorker *worker = new BindAsyncWorker(this, callback, bind_parameters);
   worker->Queue();
 
   return env.Undefined();
@@ -311,11 +326,35 @@ class ExecuteAsyncWorker : public ODBCAsyncWorker {
     ODBCConnection *odbcConnection;
     ODBCStatement  *odbcStatement;
     StatementData  *data;
+    bool            bind_parameters;
 
     void Execute() {
 
       SQLRETURN return_code;
 
+      // run() binds the parameters in the same worker, instead of a
+      // BindAsyncWorker of its own
+      if (bind_parameters && data->parameterCount > 0) {
+        data->parameters_bound = false;
+
+        return_code = odbcConnection->DescribeParameters(data);
+        if (!SQL_SUCCEEDED(return_code)) {
+          this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+          SetError("[odbc] Error retrieving information about the parameters in the statement\0");
+          return;
+        }
+
+        return_code = ODBC::BindParameters(data->hstmt, data->parameters, data->parameterCount);
+        if (!SQL_SUCCEEDED(return_code)) {
+          this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+          odbcConnection->ForgetParameterDescriptions(data);
+          SetError("[odbc] Error binding parameters to the statement\0");
+          return;
+        }
+
+        data->parameters_bound = true;
+      }
+
       // set SQL_ATTR_QUERY_TIMEOUT
       if (data->query_options.timeout > 0) {
         return_code =
@@ -370,8 +409,21 @@ class ExecuteAsyncWorker : public ODBCAsyncWorker {
       (
         data->hstmt // StatementHandle
       );
+      if (return_code == SQL_NEED_DATA) {
+        const char *error_message = "[odbc] Error sending data at execution for the statement\0";
+        return_code = ODBC::PutDataAtExecution(data->hstmt, data->query_options.timeout, &error_message);
+        if (!SQL_SUCCEEDED(return_code) && return_code != SQL_NO_DATA) {
+          this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+          SQLCancel(data->hstmt);
+          SetError(error_message);
+          return;
+        }
+      }
       if (!SQL_SUCCEEDED(return_code)) {
         this->errors = GetODBCErrors(SQL_HANDLE_STMT, data->hstmt);
+        if (data->parameterCount > 0) {
+          odbcConnection->ForgetParameterDescriptions(data);
+        }
         SetError("[odbc] Error executing the statement\0");
         return;
       }
@@ -489,10 +541,11 @@ class ExecuteAsyncWorker : public ODBCAsyncWorker {
     }
 
   public:
-    ExecuteAsyncWorker(ODBCStatement *odbcStatement, Napi::Function& callback) : ODBCAsyncWorker(callback),
+    ExecuteAsyncWorker(ODBCStatement *odbcStatement, Napi::Function& callback, bool bind_parameters = false) : ODBCAsyncWorker(callback),
       odbcConnection(odbcStatement->odbcConnection),
       odbcStatement(odbcStatement),
-      data(odbcStatement->data) {}
+      data(odbcStatement->data),
+      bind_parameters(bind_parameters) {}
 
     ~ExecuteAsyncWorker() {}
 };
@@ -555,6 +608,102 @@ Napi::Value ODBCStatement::Execute(const Napi::CallbackInfo& info) {
   return env.Undefined();
 }
 
+/******************************************************************************
+ *********************************** RUN **************************************
+ *****************************************************************************/
+
+/*
+ *  ODBCStatement:Run (Async)
+ *    Description: Binds parameters to the prepared statement and executes it
+ *                 with a single ExecuteAsyncWorker, saving the round trip to
+ *                 the thread pool of a separate bind.
+ *
+ *    Parameters:
+ *      const Napi::CallbackInfo& info:
+ *        The information passed by Napi from the JavaScript call, including
+ *        arguments from the JavaScript function. In JavaScript, the
+ *        run() function takes three arguments.
+ *
+ *        info[0]: Array: the values to bind to the parameter markers.
+ *        info[1]: Object: the query options, or null.
+ *        info[2]: Function: callback function:
+ *            function(error, result)
+ *              error: An error object if there was a problem getting results,
+ *                     or null if operation was successful.
+ *              result: The result of executing the statement, or a cursor.
+ *
+ *    Return:
+ *      Napi::Value:
+ *        Undefined (results returned in callback).
+ */
+Napi::Value ODBCStatement::Run(const Napi::CallbackInfo& info) {
+
+  Napi::Env env = info.Env();
+  Napi::HandleScope scope(env);
+
+  if (
+    info.Length() != 3 ||
+    !info[0].IsArray() ||
+    !(info[1].IsObject() || info[1].IsNull() || info[1].IsUndefined()) ||
+    !info[2].IsFunction()
+  ) {
+    Napi::TypeError::New(env, "Function signature is: run(array, object, function)").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  Napi::Array napiArray = info[0].As<Napi::Array>();
+  Napi::Function callback = info[2].As<Napi::Function>();
+
+  if(this->data->hstmt == SQL_NULL_HANDLE) {
+    Napi::Error error = Napi::Error::New(env, "Statment handle is no longer valid. Cannot run SQL on an invalid statment handle.");
+    std::vector<napi_value> callbackArguments;
+    callbackArguments.push_back(error.Value());
+    callback.Call(callbackArguments);
+    return env.Undefined();
+  }
+
+  // if the parameter count isnt right, end right away
+  if (data->parameterCount != (SQLSMALLINT)napiArray.Length() || data->parameters == NULL) {
+    std::vector<napi_value> callbackArguments;
+
+    Napi::Error error = Napi::Error::New(env, Napi::String::New(env, "[node-odbc] Error in Statement::Run: The number of parameters in the prepared statement (" + std::to_string(data->parameterCount) + ") doesn't match the number of parameters passed to run (" + std::to_string((SQLSMALLINT)napiArray.Length()) + ")."));
+    callbackArguments.push_back(error.Value());
+
+    callback.Call(callbackArguments);
+    return env.Undefined();
+  }
+
+  Napi::Value error =
+  parse_query_options
+  (
+    env,
+    info[1].IsObject() ? info[1] : Napi::Value(env.Null()),
+    &this->data->query_options
+  );
+
+  if (!error.IsNull())
+  {
+    // Error when parsing the query options. Return the callback with the error
+    std::vector<napi_value> callback_argument =
+    {
+      error
+    };
+    callback.Call(callback_argument);
+    return env.Undefined();
+  }
+
+  this->napiParameters = Napi::Persistent(napiArray);
+
+  // converts NAPI/JavaScript values to values used by SQLBindParameter,
+  // writing them into the buffers bound by an earlier run when possible
+  bool bind_parameters = ODBC::StoreBindValuesInPlace(&napiArray, this->data->parameters, this->data->parameters_bound);
+
+  ExecuteAsyncWorker *worker = new ExecuteAsyncWorker(this, callback, bind_parameters);
+  worker->Queue();
+
+  return env.Undefined();
+}
+
 /******************************************************************************
  ********************************** CLOSE *************************************
  *****************************************************************************/
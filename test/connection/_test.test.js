@@ -8,10 +8,12 @@ describe('Connection', () => {
   require('./beginTransaction.test.js');
   require('./commit.test.js');
   require('./rollback.test.js');
+  require('./resetState.test.js');
   require('./columns.test.js');
   require('./primaryKeys.test.js');
   require('./foreignkeys.test.js');
   require('./tables.test.js');
   require('./callProcedure.test.js');
+  require('./insertColumns.test.js');
   require('./setIsolationLevel.test.js');
 });
@@ -0,0 +1,65 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../lib/odbc');
+
+describe('.insertColumns(table, columns, [options], [callback])...', () => {
+  it('...should throw a TypeError if a column is not a TypedArray.', async () => {
+    const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+    assert.throws(() => {
+      connection.insertColumns(`${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { ID: [1, 2, 3] });
+    }, TypeError);
+    await connection.close();
+  });
+  it('...should throw a TypeError if the table or a column name is not an identifier.', async () => {
+    const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+    assert.throws(() => {
+      connection.insertColumns(`${process.env.DB_SCHEMA}.${process.env.DB_TABLE}; DROP TABLE X`, { ID: Int32Array.from([1]) });
+    }, TypeError);
+    assert.throws(() => {
+      connection.insertColumns(`${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { 'ID) SELECT 1 --': Int32Array.from([1]) });
+    }, TypeError);
+    await connection.close();
+  });
+  describe('...with callbacks...', () => {
+    it('...should insert the rows of the columns.', (done) => {
+      odbc.connect(`${process.env.CONNECTION_STRING}`, (error, connection) => {
+        assert.deepEqual(error, null);
+        const columns = {
+          ID: Int32Array.from([1, 2, 3]),
+          AGE: Int16Array.from([10, 20, 30]),
+        };
+        connection.insertColumns(`${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, columns, (error1, count) => {
+          assert.deepEqual(error1, null);
+          assert.strictEqual(count, 3);
+          connection.query(`SELECT ID, AGE FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`, (error2, result) => {
+            assert.deepEqual(error2, null);
+            assert.deepEqual(result.length, 3);
+            assert.deepEqual(result[2], { ID: 3, AGE: 30 });
+            connection.close((error3) => {
+              assert.deepEqual(error3, null);
+              done();
+            });
+          });
+        });
+      });
+    });
+  }); // ...with callbacks...
+  describe('...with promises...', () => {
+    it('...should insert the rows in batches sized by batchMemory.', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      const rows = 100;
+      const ids = new Int32Array(rows);
+      const ages = new Float64Array(rows);
+      for (let i = 0; i < rows; i++) {
+        ids[i] = i;
+        ages[i] = i * 2;
+      }
+      // 12 bytes per row, so 10 rows per execution
+      const count = await connection.insertColumns(`${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { ID: ids, AGE: ages }, { batchMemory: 120 });
+      assert.strictEqual(count, rows);
+      const result = await connection.query(`SELECT COUNT(*) AS COUNT FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+      assert.deepEqual(Number(result[0].COUNT), rows);
+      await connection.close();
+    });
+  }); // ...with promises...
+});
@@ -2,6 +2,7 @@
 const assert         = require('assert');
 const odbc           = require('../../lib/odbc');
 const { Cursor }     = require('../../lib/Cursor');
+const { Readable }   = require('stream');
 
 describe('.query(sql, [parameters], [options], [callback])...', () => {
   it('...should throw a TypeError if function signature doesn\'t match accepted signatures.', async () => {
@@ -376,6 +377,77 @@ describe('.query(sql, [parameters], [options], [callback])...', () => {
       await cursor.close();
       await connection.close();
     });
+    it('...should return result metadata as non-enumerable properties', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+      const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+      assert.deepEqual(Object.keys(result), ['0']);
+      assert.deepEqual(result.statement, `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+      assert.deepEqual(result.columns.length, 3);
+      assert.strictEqual(result.columns, result.columns);
+      assert.deepEqual(result.columns[0].name, 'ID');
+      await connection.close();
+    });
+    it('...should bind parameters passed with their SQL types', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      const result1 = await connection.query(
+        `INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`,
+        [
+          { value: 1, sqlType: odbc.SQL_INTEGER },
+          { value: 'committed', sqlType: odbc.SQL_VARCHAR, size: 24 },
+          10,
+        ],
+      );
+      assert.deepEqual(result1.count, 1);
+      const result2 = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = ?`, [{ value: 1, sqlType: odbc.SQL_INTEGER }]);
+      assert.deepEqual(result2.length, 1);
+      assert.deepEqual(result2[0], { ID: 1, NAME: 'committed', AGE: 10 });
+      await connection.close();
+    });
+    it('...should bind parameters passed as an object to :name parameter markers', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      const result1 = await connection.query(
+        `INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(:id, :name, :age)`,
+        { age: 10, name: 'named', id: 1 },
+      );
+      assert.deepEqual(result1.count, 1);
+      const result2 = await connection.query(
+        `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = :id AND NAME <> ':id' AND AGE >= :id`,
+        { id: 1 },
+        {},
+      );
+      assert.deepEqual(result2.length, 1);
+      assert.deepEqual(result2[0], { ID: 1, NAME: 'named', AGE: 10 });
+      await assert.rejects(async () => {
+        await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = :id`, { name: 'named' });
+      });
+      await connection.close();
+    });
+    it('...should send Readable stream parameters in chunks', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      const stream = Readable.from([Buffer.from('stre'), Buffer.from('amed')]);
+      const result1 = await connection.query(
+        `INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`,
+        [1, stream, 10],
+      );
+      assert.deepEqual(result1.count, 1);
+      const result2 = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = 1`);
+      assert.deepEqual(result2.length, 1);
+      assert.deepEqual(result2[0], { ID: 1, NAME: 'streamed', AGE: 10 });
+      await connection.close();
+    });
+    it('...should send Readable streams passed as named parameters in chunks', async () => {
+      const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+      const stream = Readable.from([Buffer.from('stre'), Buffer.from('amed')]);
+      const result1 = await connection.query(
+        `INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(:id, :name, :age)`,
+        { id: 1, name: stream, age: 10 },
+      );
+      assert.deepEqual(result1.count, 1);
+      const result2 = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = 1`);
+      assert.deepEqual(result2[0], { ID: 1, NAME: 'streamed', AGE: 10 });
+      await connection.close();
+    });
     describe('...testing query options...', () => {
       describe('...[cursor]...', () => {
         it('...should throw an error if cursor is not a boolean or string', async () => {
@@ -595,6 +667,89 @@ describe('.query(sql, [parameters], [options], [callback])...', () => {
           await connection.close();
         });
       });
+      describe('...[rowBinding]...', () => {
+        it('...should throw an error if rowBinding is not a boolean', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await assert.rejects(
+            connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { rowBinding: 1 }),
+            {
+              name: 'TypeError',
+              message: 'Connection.query options: .rowBinding must be a BOOLEAN value.'
+            }
+          );
+          await assert.rejects(
+            connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { rowBinding: 'true' }),
+            {
+              name: 'TypeError',
+              message: 'Connection.query options: .rowBinding must be a BOOLEAN value.'
+            }
+          );
+          await connection.close();
+        });
+        it('...should return the same rows as column-wise binding', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [2, null, 20]);
+          const columnWise = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`);
+          const cursor = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`, { rowBinding: true, fetchSize: 2 });
+          const rowWise = await cursor.fetch();
+          await cursor.close();
+          assert.deepEqual(rowWise.length, 2);
+          assert.deepEqual(Array.from(rowWise), Array.from(columnWise));
+          await connection.close();
+        });
+      });
+      describe('...[latin1]...', () => {
+        it('...should throw an error if latin1 is not a boolean or an array of strings', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await assert.rejects(
+            connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { latin1: 'NAME' }),
+            {
+              name: 'TypeError',
+              message: 'Connection.query options: .latin1 must be a BOOLEAN value or an ARRAY of STRING values.'
+            }
+          );
+          await assert.rejects(
+            connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { latin1: ['NAME', 1] }),
+            {
+              name: 'TypeError',
+              message: 'Connection.query options: .latin1 must be a BOOLEAN value or an ARRAY of STRING values.'
+            }
+          );
+          await connection.close();
+        });
+        it('...should return the same ASCII values as without the option', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+          const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { latin1: ['NAME'] });
+          assert.deepEqual(result.length, 1);
+          assert.deepEqual(result[0].NAME, 'committed');
+          await connection.close();
+        });
+      });
+      describe('...[intern]...', () => {
+        it('...should throw an error if intern is not a boolean', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await assert.rejects(
+            connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { intern: 1 }),
+            {
+              name: 'TypeError',
+              message: 'Connection.query options: .intern must be a BOOLEAN value.'
+            }
+          );
+          await connection.close();
+        });
+        it('...should return repeated values unchanged', async () => {
+          const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [2, 'committed', 20]);
+          await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [3, 'rolledback', 30]);
+          const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`, { intern: true });
+          assert.deepEqual(result.length, 3);
+          assert.deepEqual(result.map((row) => row.NAME), ['committed', 'committed', 'rolledback']);
+          await connection.close();
+        });
+      });
     });
   }); // ...with promises...
 }); // '.query(sql, [parameters], [callback])...'
@@ -0,0 +1,52 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../lib/odbc');
+
+describe('.resetState(callback)...', () => {
+  it('...should rollback an open transaction and turn autocommit back on.', async () => {
+    const connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+    await connection.beginTransaction();
+    assert.deepEqual(connection.autocommit, false);
+    await connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(2, 'rolledback', 20)`);
+    await connection.resetState();
+    assert.deepEqual(connection.autocommit, true);
+    const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+    assert.deepEqual(result.length, 0);
+    await connection.close();
+  });
+  it('...should do nothing if the state of the connection wasn\'t changed.', (done) => {
+    odbc.connect(`${process.env.CONNECTION_STRING}`, (error, connection) => {
+      assert.deepEqual(error, null);
+      connection.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(1, 'committed', 10)`, (error1) => {
+        assert.deepEqual(error1, null);
+        connection.resetState((error2) => {
+          assert.deepEqual(error2, null);
+          assert.deepEqual(connection.autocommit, true);
+          connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, (error3, result3) => {
+            assert.deepEqual(error3, null);
+            assert.deepEqual(result3.length, 1);
+            connection.close(done);
+          });
+        });
+      });
+    });
+  });
+  it('...should be called by a Pool when a connection is returned mid-transaction.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+    });
+    const connection1 = await pool.connect();
+    await connection1.beginTransaction();
+    await connection1.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(2, 'rolledback', 20)`);
+    await connection1.close();
+    const connection2 = await pool.connect();
+    assert.deepEqual(connection2.autocommit, true);
+    const result = await connection2.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+    assert.deepEqual(result.length, 0);
+    await connection2.close();
+    await pool.close();
+  });
+});
@@ -5,5 +5,8 @@ describe('Pool', () => {
   require('./constructor.test.js');
   require('./connect.test.js');
   require('./query.test.js');
+  require('./batchLoader.test.js');
+  require('./stats.test.js');
+  require('./endpoints.test.js');
   require('./close.test.js');
 });
@@ -0,0 +1,56 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../');
+
+describe('.batchLoader...', () => {
+  it('...should route the rows of keys loaded in the same tick back to their callers.', async () => {
+    const pool = await odbc.pool(`${process.env.CONNECTION_STRING}`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(1, 'one', 10)`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(2, 'two', 20)`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(2, 'second two', 22)`);
+    const loader = pool.batchLoader(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID IN (?)`, { key: 'ID' });
+    const [rows1, rows2, rows3, rows1Again] = await Promise.all([
+      loader.load(1),
+      loader.load(2),
+      loader.load(3),
+      loader.load(1),
+    ]);
+    assert.deepEqual(rows1, [{ ID: 1, NAME: 'one', AGE: 10 }]);
+    assert.deepEqual(rows2.length, 2);
+    assert.deepEqual(rows2.map((row) => row.AGE).sort(), [20, 22]);
+    assert.deepEqual(rows3, []);
+    assert.deepEqual(rows1Again, rows1);
+    await pool.close();
+  });
+  it('...should split batches larger than maxBatch into several queries.', async () => {
+    const pool = await odbc.pool(`${process.env.CONNECTION_STRING}`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(1, 'one', 10)`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(5, 'five', 50)`);
+    const loader = pool.batchLoader(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID IN (?)`, { key: (row) => row.ID, maxBatch: 2 });
+    const results = await loader.loadMany([1, 2, 3, 4, 5]);
+    assert.deepEqual(results, [
+      [{ ID: 1, NAME: 'one', AGE: 10 }],
+      [],
+      [],
+      [],
+      [{ ID: 5, NAME: 'five', AGE: 50 }],
+    ]);
+    await pool.close();
+  });
+  it('...should match keys returned as strings to the keys loaded.', async () => {
+    const pool = await odbc.pool(`${process.env.CONNECTION_STRING}`);
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(1, 'one', 10)`);
+    const loader = pool.batchLoader(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID IN (?)`, { key: (row) => `${row.ID}` });
+    const [rows1, rows1String] = await Promise.all([loader.load(1), loader.load('1')]);
+    assert.deepEqual(rows1, [{ ID: 1, NAME: 'one', AGE: 10 }]);
+    assert.deepEqual(rows1String, rows1);
+    await pool.close();
+  });
+  it('...should throw a TypeError if the SQL template doesn\'t have exactly one parameter marker.', async () => {
+    const pool = await odbc.pool(`${process.env.CONNECTION_STRING}`);
+    assert.throws(() => {
+      pool.batchLoader(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID IN (?, ?)`, { key: 'ID' });
+    }, TypeError);
+    await pool.close();
+  });
+});
@@ -0,0 +1,128 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../');
+
+describe('.connect...', () => {
+  it('...should time out after acquireTimeoutMs when no connection is free.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+    });
+    const connection = await pool.connect();
+    await assert.rejects(
+      pool.connect({ acquireTimeoutMs: 100 }),
+      {
+        message: '[node-odbc]: Timed out after 100 ms waiting for a connection from the pool.',
+      },
+    );
+    await connection.close();
+    await pool.close();
+  });
+  it('...should fail with the abort reason when the signal is aborted, and hand the connection to the next waiter.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+    });
+    const connection1 = await pool.connect();
+    const controller = new AbortController();
+    const aborted = pool.connect({ signal: controller.signal });
+    const waiting = pool.connect();
+    controller.abort();
+    await assert.rejects(aborted, { name: 'AbortError' });
+    await connection1.close();
+    const connection2 = await waiting;
+    assert.strictEqual(connection2, connection1);
+    await connection2.close();
+    await pool.close();
+  });
+  it('...should fail right away when maxWaiting requests are already waiting.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+      maxWaiting: 1,
+    });
+    const connection1 = await pool.connect();
+    const waiting = pool.connect();
+    await assert.rejects(
+      pool.connect(),
+      {
+        message: '[node-odbc]: Too many requests (1) are waiting for a connection from the pool.',
+      },
+    );
+    await connection1.close();
+    const connection2 = await waiting;
+    await connection2.close();
+    await pool.close();
+  });
+  it('...should validate free connections with validationQuery, and replace the ones that fail.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+      checkConnectionDead: true,
+      validationQuery: `SELECT COUNT(*) FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`,
+    });
+    const connection1 = await pool.connect();
+    await connection1.close();
+    const connection2 = await pool.connect();
+    assert.strictEqual(connection2, connection1);
+    await connection2.close();
+
+    // a validation query that fails makes the pool open a new connection
+    pool.validationQuery = 'SELECT * FROM NODE_ODBC_TABLE_THAT_DOES_NOT_EXIST';
+    const connection3 = await pool.connect();
+    assert.notStrictEqual(connection3, connection1);
+    assert.deepEqual(connection3.connected, true);
+    await connection3.close();
+    await pool.close();
+  });
+  it('...should give connections to waiting work by priority, keeping tenants under their limits.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+      priorities: { critical: 10, bulk: 1 },
+      tenantLimits: { batch: 1 },
+    });
+    const order = [];
+    const connection = await pool.connect({ priority: 'bulk', tenant: 'batch' });
+    const bulk = pool.connect({ priority: 'bulk', tenant: 'batch' }).then(async (bulkConnection) => {
+      order.push('bulk');
+      await bulkConnection.close();
+    });
+    const critical = pool.connect({ priority: 'critical', tenant: 'api' }).then(async (criticalConnection) => {
+      order.push('critical');
+      await criticalConnection.close();
+    });
+    await assert.rejects(pool.connect({ priority: 'unknown' }), TypeError);
+    await connection.close();
+    await Promise.all([bulk, critical]);
+    assert.deepEqual(order, ['critical', 'bulk']);
+    await pool.close();
+  });
+  it('...should not grow the pool for work waiting on the limit of its tenant.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 3,
+      tenantLimits: { batch: 1 },
+    });
+    const connection = await pool.connect({ tenant: 'batch' });
+    const waiting = pool.connect({ tenant: 'batch' });
+    assert.deepEqual(pool.stats().connecting, 0);
+    assert.deepEqual(pool.stats().size, 1);
+    await connection.close();
+    const connection2 = await waiting;
+    await connection2.close();
+    await pool.close();
+  });
+});
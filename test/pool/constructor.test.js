@@ -69,5 +69,30 @@ describe('odbc.pool...', () => {
       assert.deepEqual(connection instanceof Connection, true);
       pool.close();
     });
+    it('...should have `minReadySize` open connections when it resolves.', async () => {
+      const poolConfig = {
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        initialSize: 5,
+        minReadySize: 3,
+      };
+      const pool = await odbc.pool(poolConfig);
+      assert.deepEqual(pool.poolSize >= 3, true);
+      await delay(5000);
+      assert.deepEqual(pool.freeConnections.length, 5);
+      pool.close();
+    });
+    it('...should close connections idle for `idleTimeoutMs` down to `minSize`.', async () => {
+      const poolConfig = {
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        initialSize: 3,
+        minSize: 1,
+        idleTimeoutMs: 500,
+      };
+      const pool = await odbc.pool(poolConfig);
+      await delay(5000);
+      assert.deepEqual(pool.freeConnections.length, 1);
+      assert.deepEqual(pool.poolSize, 1);
+      pool.close();
+    });
   }); // ...with promises...
 });
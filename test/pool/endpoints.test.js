@@ -0,0 +1,68 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../');
+
+describe('...with multiple endpoints...', () => {
+  it('...should send readOnly queries to the replicas and other queries to the primary.', async () => {
+    const pool = await odbc.pool({
+      endpoints: [
+        { connectionString: `${process.env.CONNECTION_STRING}`, name: 'primary' },
+        { connectionString: `${process.env.CONNECTION_STRING}`, name: 'replica', role: 'replica' },
+      ],
+      initialSize: 1,
+    });
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+    const result = await pool.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, { readOnly: true });
+    assert.deepEqual(result.length, 1);
+    const [primary, replica] = pool.stats().endpoints;
+    assert.deepEqual(primary.healthy, true);
+    assert.deepEqual(primary.pool.queryDuration.count, 1);
+    assert.deepEqual(replica.healthy, true);
+    assert.deepEqual(replica.pool.queryDuration.count, 1);
+    assert.deepEqual(replica.inFlight, 0);
+    await pool.close();
+  });
+  it('...should count connections from .connect as work on their endpoint until they are closed.', async () => {
+    const pool = await odbc.pool({
+      endpoints: [
+        `${process.env.CONNECTION_STRING}`,
+        { connectionString: `${process.env.CONNECTION_STRING}`, role: 'replica' },
+      ],
+      initialSize: 1,
+    });
+    const connection = await pool.connect({ readOnly: true });
+    assert.deepEqual(pool.stats().endpoints.map((endpoint) => endpoint.inFlight), [0, 1]);
+    await connection.close();
+    assert.deepEqual(pool.stats().endpoints.map((endpoint) => endpoint.inFlight), [0, 0]);
+    await pool.close();
+  });
+  it('...should load batches on the replicas and invalidate the cache of every endpoint.', async () => {
+    const pool = await odbc.pool({
+      endpoints: [
+        { connectionString: `${process.env.CONNECTION_STRING}`, name: 'primary' },
+        { connectionString: `${process.env.CONNECTION_STRING}`, name: 'replica', role: 'replica' },
+      ],
+      initialSize: 1,
+      cache: true,
+    });
+    await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+    const loader = pool.batchLoader(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID IN (?)`, { key: 'ID' });
+    const rows = await loader.load(1);
+    assert.deepEqual(rows, [{ ID: 1, NAME: 'committed', AGE: 10 }]);
+    assert.deepEqual(pool.stats().endpoints[1].pool.queryDuration.count, 1);
+
+    const sql = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`;
+    const result1 = await pool.query(sql, { readOnly: true, cache: { tags: ['people'] } });
+    pool.invalidate('people');
+    const result2 = await pool.query(sql, { readOnly: true, cache: { tags: ['people'] } });
+    assert.deepEqual(result2, result1);
+    assert.deepEqual(pool.stats().endpoints[1].pool.queryDuration.count, 3);
+    assert.deepEqual(pool.coalescingStats().queries, 0);
+    await pool.close();
+  });
+  it('...should throw a TypeError when no endpoint is a primary.', () => {
+    assert.throws(() => odbc.pool({
+      endpoints: [{ connectionString: `${process.env.CONNECTION_STRING}`, role: 'replica' }],
+    }), TypeError);
+  });
+});
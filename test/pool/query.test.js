@@ -601,4 +601,98 @@ describe('.query...', () => {
       });
     });
   }); // ...with promises...
+  describe('...with caching...', () => {
+    it('...should return a copy of the cached result until it is invalidated.', async () => {
+      const pool = await odbc.pool({
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        cache: true,
+      });
+      const sql = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`;
+      await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+      const result1 = await pool.query(sql, { cache: { tags: ['table'] } });
+      assert.deepEqual(result1.length, 1);
+      await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [2, 'rolledback', 20]);
+      const result2 = await pool.query(sql, { cache: { tags: ['table'] } });
+      assert.notStrictEqual(result2, result1);
+      assert.deepEqual(result2, result1);
+      assert.deepEqual(result2.columns, result1.columns);
+      pool.invalidate('table');
+      const result3 = await pool.query(sql, { cache: { tags: ['table'] } });
+      assert.deepEqual(result3.length, 2);
+      await pool.close();
+    });
+    it('...should keep the count, columns, and statement of cached results.', async () => {
+      const pool = await odbc.pool({
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        cache: true,
+      });
+      const sql = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`;
+      const result1 = await pool.query(sql, { cache: true });
+      const result2 = await pool.query(sql, { cache: true });
+      assert.notStrictEqual(result2, result1);
+      assert.deepEqual(result2.count, result1.count);
+      assert.deepEqual(result2.statement, sql);
+      assert.deepEqual(result2.columns.length, 3);
+      assert.deepEqual(result2.columns, result1.columns);
+      assert.deepEqual(Object.keys(result2), Object.keys(result1));
+      await pool.close();
+    });
+  });
+  describe('...with coalescing...', () => {
+    it('...should run identical queries started at the same time only once.', async () => {
+      const pool = await odbc.pool({
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        coalesce: true,
+      });
+      await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10]);
+      const sql = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} WHERE ID = ?`;
+      const results = await Promise.all([
+        pool.query(sql, [1]),
+        pool.query(sql, [1]),
+        pool.query(sql, [1]),
+        pool.query(sql, [2]),
+      ]);
+      assert.deepEqual(results[0].length, 1);
+      assert.deepEqual(results[0][0], { ID: 1, NAME: 'committed', AGE: 10 });
+      assert.notStrictEqual(results[1], results[0]);
+      assert.deepEqual(results[1], results[0]);
+      assert.deepEqual(results[1].count, results[0].count);
+      assert.deepEqual(results[1].columns, results[0].columns);
+      assert.deepEqual(results[2], results[0]);
+      assert.deepEqual(results[3].length, 0);
+      const stats = pool.coalescingStats();
+      assert.deepEqual(stats.queries, 4);
+      assert.deepEqual(stats.coalesced, 2);
+      assert.deepEqual(stats.ratio, 0.5);
+      await pool.close();
+    });
+    it('...should not coalesce statements that could write.', async () => {
+      const pool = await odbc.pool({
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        coalesce: true,
+      });
+      const sql = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} FOR UPDATE`;
+      const results = await Promise.all([
+        pool.query(sql),
+        pool.query(sql),
+      ]);
+      assert.notStrictEqual(results[1], results[0]);
+      assert.deepEqual(pool.coalescingStats().queries, 0);
+      await pool.close();
+    });
+  });
+  describe('...with retries...', () => {
+    it('...should not run a query again after an error that can\'t be retried.', async () => {
+      const pool = await odbc.pool({
+        connectionString: `${process.env.CONNECTION_STRING}`,
+        retry: { baseDelayMs: 10 },
+      });
+      await assert.rejects(pool.query(`SELECT * FROM ${process.env.DB_SCHEMA}.NO_SUCH_TABLE`));
+      assert.deepEqual(pool.stats().retries, 0);
+      const result = await pool.query(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, [1, 'committed', 10], { idempotent: true });
+      assert.deepEqual(result.count, 1);
+      assert.deepEqual(pool.stats().retries, 0);
+      await pool.close();
+    });
+  });
 });
@@ -0,0 +1,62 @@
+/* eslint-env node, mocha */
+const assert             = require('assert');
+const diagnosticsChannel = require('diagnostics_channel');
+const odbc               = require('../../');
+
+describe('.stats...', () => {
+  it('...should count connections and record how long acquiring connections and queries took.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      incrementSize: 1,
+      maxSize: 1,
+    });
+    await pool.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`);
+    const connection = await pool.connect();
+    await assert.rejects(pool.connect({ acquireTimeoutMs: 50 }));
+    const stats = pool.stats();
+    assert.deepEqual(stats.size, 1);
+    assert.deepEqual(stats.inUse, 1);
+    assert.deepEqual(stats.idle, 0);
+    assert.deepEqual(stats.waiting, 0);
+    assert.deepEqual(stats.acquireTimeouts, 1);
+    assert.deepEqual(stats.acquireWait.count, 2);
+    assert.deepEqual(stats.queryDuration.count, 1);
+    assert.deepEqual(stats.queryDuration.max > 0, true);
+    assert.deepEqual(stats.queryDuration.p50 <= stats.queryDuration.max, true);
+    await connection.close();
+    await pool.close();
+  });
+  it('...should report the concurrency limit of the Pool and the queries running under it.', async () => {
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 2,
+      concurrencyLimit: { initialLimit: 1, maxLimit: 1, maxQueue: 1 },
+    });
+    assert.deepEqual(pool.stats().concurrencyLimit.limit, 1);
+    const query = `SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`;
+    const results = await Promise.allSettled([pool.query(query), pool.query(query), pool.query(query)]);
+    assert.deepEqual(results.map((result) => result.status), ['fulfilled', 'fulfilled', 'rejected']);
+    const stats = pool.stats().concurrencyLimit;
+    assert.deepEqual(stats.inFlight, 0);
+    assert.deepEqual(stats.queued, 0);
+    assert.deepEqual(stats.rejected, 1);
+    await pool.close();
+  });
+  it('...should publish snapshots to the odbc:pool:stats diagnostics channel.', async () => {
+    const snapshots = [];
+    const onSnapshot = (message) => snapshots.push(message);
+    diagnosticsChannel.subscribe('odbc:pool:stats', onSnapshot);
+    const pool = await odbc.pool({
+      connectionString: `${process.env.CONNECTION_STRING}`,
+      initialSize: 1,
+      statsIntervalMs: 100,
+    });
+    await new Promise((resolve) => setTimeout(resolve, 1500));
+    diagnosticsChannel.unsubscribe('odbc:pool:stats', onSnapshot);
+    const snapshot = snapshots.find((message) => message.pool === pool);
+    assert.notDeepEqual(snapshot, undefined);
+    assert.deepEqual(snapshot.stats.size, 1);
+    await pool.close();
+  });
+});
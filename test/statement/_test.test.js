@@ -5,5 +5,6 @@ describe('Statement', () => {
   require('./prepare.test.js');
   require('./bind.test.js');
   require('./execute.test.js');
+  require('./run.test.js');
   require('./close.test.js');
 });
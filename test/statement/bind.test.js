@@ -166,5 +166,21 @@ describe('.bind(parameters, [calback])...', () => {
         await statement.bind([]);
       });
     });
+    it('...should rebind new values, including longer strings and nulls, for each execution.', async () => {
+      const statement = await connection.createStatement();
+      await statement.prepare(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`);
+      await statement.bind([1, 'a', 10]);
+      await statement.execute();
+      await statement.bind([2, 'a longer bound value', null]);
+      await statement.execute();
+      await statement.bind([3, 'b', 30]);
+      await statement.execute();
+      const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`);
+      assert.deepEqual(result.length, 3);
+      assert.deepEqual(result[0], { ID: 1, NAME: 'a', AGE: 10 });
+      assert.deepEqual(result[1], { ID: 2, NAME: 'a longer bound value', AGE: null });
+      assert.deepEqual(result[2], { ID: 3, NAME: 'b', AGE: 30 });
+      await statement.close();
+    });
   }); // '...with promises...'
 });
@@ -0,0 +1,77 @@
+/* eslint-env node, mocha */
+const assert = require('assert');
+const odbc   = require('../../lib/odbc');
+
+describe('.run(parameters, [options], [callback])...', () => {
+  let connection = null;
+
+  beforeEach(async () => {
+    connection = await odbc.connect(`${process.env.CONNECTION_STRING}`);
+  });
+
+  afterEach(async () => {
+    await connection.close();
+    connection = null;
+  });
+
+  it('...should throw a TypeError if function signature doesn\'t match accepted signatures.', async () => {
+    const statement = await connection.prepare(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`);
+
+    const RUN_TYPE_ERROR = {
+      name: 'TypeError',
+      message: '[node-odbc]: Incorrect function signature for call to statement.run({array}, {object}[optional], {function}[optional]).',
+    };
+    const DUMMY_CALLBACK = () => {};
+
+    assert.throws(() => {
+      statement.run();
+    }, RUN_TYPE_ERROR);
+    assert.throws(() => {
+      statement.run(1, DUMMY_CALLBACK);
+    }, RUN_TYPE_ERROR);
+    assert.throws(() => {
+      statement.run([1, 'bound', 10], 1);
+    }, RUN_TYPE_ERROR);
+    await statement.close();
+  });
+  describe('...with callbacks...', () => {
+    it('...should bind and execute a statement returned by connection.prepare.', (done) => {
+      connection.prepare(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`, (error1, statement) => {
+        assert.deepEqual(error1, null);
+        assert.notDeepEqual(statement, null);
+        statement.run([1, 'run', 10], (error2, result2) => {
+          assert.deepEqual(error2, null);
+          assert.notDeepEqual(result2, null);
+          connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE}`, (error3, result3) => {
+            assert.deepEqual(error3, null);
+            assert.deepEqual(result3.length, 1);
+            assert.deepEqual(result3[0], { ID: 1, NAME: 'run', AGE: 10 });
+            statement.close((error4) => {
+              assert.deepEqual(error4, null);
+              done();
+            });
+          });
+        });
+      });
+    });
+  }); // ...with callbacks...
+  describe('...with promises...', () => {
+    it('...should bind and execute the statement repeatedly with new values.', async () => {
+      const statement = await connection.prepare(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`);
+      for (let i = 1; i <= 3; i++) {
+        await statement.run([i, `run ${i}`, i * 10]);
+      }
+      const result = await connection.query(`SELECT * FROM ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} ORDER BY ID`);
+      assert.deepEqual(result.length, 3);
+      assert.deepEqual(result[2], { ID: 3, NAME: 'run 3', AGE: 30 });
+      await statement.close();
+    });
+    it('...should return an error if the number of parameters doesn\'t match the statement.', async () => {
+      const statement = await connection.prepare(`INSERT INTO ${process.env.DB_SCHEMA}.${process.env.DB_TABLE} VALUES(?, ?, ?)`);
+      await assert.rejects(async () => {
+        await statement.run([1, 'run']);
+      });
+      await statement.close();
+    });
+  }); // ...with promises...
+});